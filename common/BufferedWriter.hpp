@@ -0,0 +1,185 @@
+/// @file BufferedWriter.hpp
+/// @author Brandon Timok <8000477724@student.csn.edu>
+/// @date 03/14/2022
+/// @brief A BufferedWriter formats values with std::to_chars into a fixed
+/// chunk and hands the chunk to a std::ostream in large writes, instead of
+/// going through the stream machinery once per value.
+///
+/// Shared by the lottery containers and the linked lists; include it as
+/// "../common/BufferedWriter.hpp".
+
+#ifndef BUFFERED_WRITER_HPP
+#define BUFFERED_WRITER_HPP
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <locale>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/// Writes formatted values to a std::ostream through a fixed-size chunk.
+/// Numbers are formatted with std::to_chars whenever the stream's flags can
+/// be reproduced exactly (decimal integers, fixed/scientific/general floating
+/// point, classic locale, no field width); anything else is handed to the
+/// stream's own operator<<, so the output is always the same.
+class BufferedWriter {
+public:
+    /// Number of bytes gathered before each write to the stream.
+    static constexpr std::size_t chunk_size = 8192;
+
+    /// Prepares to write to output.
+    explicit BufferedWriter(std::ostream& output)
+    : output(output), plain(output.getloc() == std::locale::classic()) {}
+
+    BufferedWriter(const BufferedWriter&) = delete;
+    BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+    /// Flushes whatever is left. Errors are reported through the stream state.
+    ~BufferedWriter() {
+        try {
+            flush();
+        } catch (...) {
+            // the stream has already recorded the failure in its state
+        }
+    }
+
+    /// Writes a single character.
+    void put(char c) {
+        if (used == chunk_size) {
+            flush();
+        }
+        chunk[used++] = c;
+    }
+
+    /// Writes count characters starting at text.
+    void write(const char* text, std::size_t count);
+
+    /// Writes a formatted representation of value, as output << value would.
+    template <class T>
+    void write(const T& value);
+
+    /// Hands the gathered characters to the stream.
+    void flush() {
+        if (used != 0) {
+            output.write(chunk, used);
+            used = 0;
+        }
+    }
+
+private:
+    /// Formats an arithmetic value with std::to_chars if the stream's flags
+    /// allow it. @returns false if the value must go through the stream.
+    template <class T>
+    bool format(const T& value);
+
+    std::ostream& output;             ///< Destination stream.
+    bool          plain;              ///< Stream uses the classic locale.
+    std::size_t   used = 0;           ///< Characters waiting in chunk.
+    char          chunk[chunk_size];  ///< Characters not yet written.
+};
+
+// ============================================================================
+
+/// Writes count characters starting at text.
+inline void BufferedWriter::write(const char* text, std::size_t count) {
+    if (count > chunk_size - used) {
+        flush();
+        if (count >= chunk_size) {
+            output.write(text, count);
+            return;
+        }
+    }
+    std::memcpy(chunk + used, text, count);
+    used += count;
+}
+
+/// Writes a formatted representation of value, as output << value would.
+template <class T>
+void BufferedWriter::write(const T& value) {
+    if constexpr (std::is_same<T, char>::value) {
+        if (output.width() == 0) {
+            put(value);
+            return;
+        }
+    } else if constexpr (std::is_convertible<const T&, std::string_view>::value) {
+        if (output.width() == 0) {
+            const std::string_view text(value);
+            write(text.data(), text.size());
+            return;
+        }
+    } else if constexpr (std::is_arithmetic<T>::value && !std::is_same<T, bool>::value
+                         && sizeof(T) > 1) {
+        if (format(value)) {
+            return;
+        }
+    }
+
+    // not something to_chars can reproduce: let the stream do it
+    flush();
+    output << value;
+}
+
+/// Formats an arithmetic value with std::to_chars if the stream's flags
+/// allow it. @returns false if the value must go through the stream.
+template <class T>
+bool BufferedWriter::format(const T& value) {
+    const std::ios_base::fmtflags flags = output.flags();
+
+    if (!plain || output.width() != 0 || (flags & std::ios_base::showpos)) {
+        return false;
+    }
+
+    // room for any integer, or a double in fixed notation with a sane precision
+    constexpr std::size_t room = 512;
+
+    if (chunk_size - used < room) {
+        flush();
+    }
+
+    std::to_chars_result result{};
+    char* first = chunk + used;
+    char* last = chunk + chunk_size;
+
+    if constexpr (std::is_integral<T>::value) {
+        if ((flags & std::ios_base::basefield) != std::ios_base::dec
+            && (flags & std::ios_base::basefield) != 0) {
+            return false;
+        }
+        result = std::to_chars(first, last, value);
+    } else {
+        const std::ios_base::fmtflags field = flags & std::ios_base::floatfield;
+        const auto precision = static_cast<int>(output.precision());
+
+        if (precision > 100 || (flags & std::ios_base::uppercase)) {
+            return false;
+        }
+        if (field == std::ios_base::fixed) {
+            if ((flags & std::ios_base::showpoint) && precision == 0) {
+                return false;
+            }
+            result = std::to_chars(first, last, value, std::chars_format::fixed, precision);
+        } else if (field == std::ios_base::scientific) {
+            if ((flags & std::ios_base::showpoint) && precision == 0) {
+                return false;
+            }
+            result = std::to_chars(first, last, value, std::chars_format::scientific, precision);
+        } else if (field == std::ios_base::fmtflags{} && !(flags & std::ios_base::showpoint)) {
+            result = std::to_chars(first, last, value, std::chars_format::general,
+                                   precision == 0 ? 1 : precision);
+        } else {
+            return false;  // hexfloat, or general with trailing zeros kept
+        }
+    }
+
+    if (result.ec != std::errc{}) {
+        return false;
+    }
+    used = result.ptr - chunk;
+    return true;
+}
+
+#endif /* BUFFERED_WRITER_HPP */
+
+/* EOF */
@@ -0,0 +1,308 @@
+/// @file Serialize.hpp
+/// @author Brandon Timok <8000477724@student.csn.edu>
+/// @date 03/14/2022
+/// @brief Building blocks of the binary snapshot format shared by the
+/// containers: a fixed header followed by the items. Trivially copyable items
+/// are stored as their raw bytes (native byte order); strings are stored as a
+/// 64-bit length followed by their characters.
+///
+/// Shared by the lottery containers and the linked lists; include it as
+/// "../common/Serialize.hpp".
+
+#ifndef SERIALIZE_HPP
+#define SERIALIZE_HPP
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace serial {
+
+/// Version written into every header. load() rejects any other version.
+constexpr std::uint32_t version = 1;
+
+/// Fixed-size header at the start of every snapshot.
+struct Header {
+    char          magic[4];   ///< Identifies the container type, e.g. "CTNR".
+    std::uint32_t version;    ///< Format version.
+    std::uint32_t item_size;  ///< sizeof(item) if trivially copyable, else 0.
+    std::uint32_t reserved;   ///< Always 0.
+    std::uint64_t count;      ///< Number of items that follow.
+};
+
+/// Checks whether T is a std::basic_string.
+template <class T>
+struct is_string : std::false_type {};
+
+template <class C, class Traits, class Alloc>
+struct is_string<std::basic_string<C, Traits, Alloc>>
+: std::is_trivially_copyable<C> {};
+
+/// Checks whether T can be written by this format.
+template <class T>
+constexpr bool is_serializable_v = std::is_trivially_copyable<T>::value || is_string<T>::value;
+
+/// The item_size recorded in the header for items of type T.
+template <class T>
+constexpr std::uint32_t item_size_v = std::is_trivially_copyable<T>::value ? sizeof(T) : 0;
+
+/// Writes bytes to a std::ostream.
+class StreamSink {
+public:
+    explicit StreamSink(std::ostream& output) : output(output) {}
+
+    void write(const void* bytes, std::size_t count) {
+        if (!output.write(static_cast<const char*>(bytes), count)) {
+            throw std::runtime_error("serial: write failed");
+        }
+    }
+
+private:
+    std::ostream& output;
+};
+
+/// Appends bytes to a std::vector<char>.
+class BufferSink {
+public:
+    explicit BufferSink(std::vector<char>& buffer) : buffer(buffer) {}
+
+    void write(const void* bytes, std::size_t count) {
+        auto first = static_cast<const char*>(bytes);
+        buffer.insert(buffer.end(), first, first + count);
+    }
+
+private:
+    std::vector<char>& buffer;
+};
+
+/// Reads bytes from a std::istream.
+class StreamSource {
+public:
+    explicit StreamSource(std::istream& input) : input(input) {}
+
+    void read(void* bytes, std::size_t count) {
+        if (!input.read(static_cast<char*>(bytes), count)) {
+            throw std::runtime_error("serial: truncated input");
+        }
+    }
+
+    /// A stream cannot tell how much is left; reads fail when it runs out.
+    void require(std::uint64_t, std::size_t) const {}
+
+    /// Returns how many of count items of item_bytes each may be allocated
+    /// for before they are read. A count taken from a stream is unchecked,
+    /// so storage grows with the data that actually arrives.
+    std::uint64_t reservable(std::uint64_t count, std::size_t item_bytes) const {
+        return std::min<std::uint64_t>(count, max_reserve / std::max<std::size_t>(item_bytes, 1));
+    }
+
+    /// Most bytes allocated ahead of the data read from a stream.
+    static constexpr std::size_t max_reserve = 65536;
+
+private:
+    std::istream& input;
+};
+
+/// Reads bytes from the range [first, last).
+class BufferSource {
+public:
+    BufferSource(const char* first, const char* last) : current(first), last(last) {}
+
+    void read(void* bytes, std::size_t count) {
+        require(count, 1);
+        std::memcpy(bytes, current, count);
+        current += count;
+    }
+
+    /// Checks that count items of at least item_bytes each can follow.
+    void require(std::uint64_t count, std::size_t item_bytes) const {
+        const auto left = static_cast<std::uint64_t>(last - current);
+
+        if (item_bytes != 0 && count > left / item_bytes) {
+            throw std::runtime_error("serial: truncated input");
+        }
+    }
+
+    /// Returns count: require() has already checked the buffer holds it.
+    std::uint64_t reservable(std::uint64_t count, std::size_t) const { return count; }
+
+    /// Returns the first byte that has not been read.
+    const char* position() const { return current; }
+
+private:
+    const char* current;
+    const char* last;
+};
+
+/// Writes a header for count items of type T.
+template <class T, class Sink>
+void write_header(Sink& sink, const char (&magic)[5], std::uint64_t count) {
+    Header header{};
+
+    std::memcpy(header.magic, magic, sizeof header.magic);
+    header.version = version;
+    header.item_size = item_size_v<T>;
+    header.count = count;
+    sink.write(&header, sizeof header);
+}
+
+/// Reads and checks a header written for items of type T.
+/// @returns the number of items that follow.
+template <class T, class Source>
+std::uint64_t read_header(Source& source, const char (&magic)[5]) {
+    Header header{};
+
+    source.read(&header, sizeof header);
+    if (std::memcmp(header.magic, magic, sizeof header.magic) != 0) {
+        throw std::runtime_error("serial: wrong container type");
+    }
+    if (header.version != version) {
+        throw std::runtime_error("serial: unsupported version");
+    }
+    if (header.item_size != item_size_v<T>) {
+        throw std::runtime_error("serial: wrong item type");
+    }
+    // reject counts the input cannot possibly hold before anyone reserves
+    source.require(header.count, item_size_v<T> != 0 ? item_size_v<T> : sizeof(std::uint64_t));
+    return header.count;
+}
+
+/// Writes a single item.
+template <class T, class Sink>
+void write_item(Sink& sink, const T& item) {
+    static_assert(is_serializable_v<T>, "serial: cannot write this type");
+
+    if constexpr (is_string<T>::value) {
+        const std::uint64_t length = item.size();
+
+        sink.write(&length, sizeof length);
+        sink.write(item.data(), length * sizeof(typename T::value_type));
+    } else {
+        sink.write(&item, sizeof item);
+    }
+}
+
+/// Returns the T whose object representation is the sizeof(T) bytes at
+/// bytes. T is trivially copyable and need not be default-constructible.
+template <class T>
+T from_bytes(const unsigned char* bytes) {
+    static_assert(std::is_trivially_copyable<T>::value, "serial: T must be trivially copyable");
+
+    struct Raw {
+        unsigned char bytes[sizeof(T)];
+    } raw;
+
+    std::memcpy(raw.bytes, bytes, sizeof(T));
+    // std::bit_cast before C++20; GCC, Clang and MSVC all provide it
+    return __builtin_bit_cast(T, raw);
+}
+
+/// Returns how many of the count - done items still to come to allocate
+/// for and read next. From a buffer, which has been checked to hold them,
+/// that is all of them. From a stream it is a batch that doubles with the
+/// items already read, so a long reload regrows only a few times, while a
+/// corrupt count costs no more memory than about twice the data received.
+template <class Source>
+std::uint64_t next_batch(const Source& source, std::uint64_t count, std::uint64_t done,
+                         std::size_t item_bytes) {
+    const std::uint64_t left = count - done;
+
+    return std::max(source.reservable(left, item_bytes), std::min(left, done));
+}
+
+/// Reads a single item. T need not be default-constructible unless it is a
+/// string, whose characters are read in pieces no larger than the source
+/// lets it reserve.
+template <class T, class Source>
+T read_item(Source& source) {
+    static_assert(is_serializable_v<T>, "serial: cannot read this type");
+
+    if constexpr (is_string<T>::value) {
+        using C = typename T::value_type;
+        std::uint64_t length = 0;
+        T item{};
+
+        source.read(&length, sizeof length);
+        source.require(length, sizeof(C));
+        while (item.size() < length) {
+            const std::size_t done = item.size();
+            const auto batch = static_cast<std::size_t>(source.reservable(length - done, sizeof(C)));
+
+            item.resize(done + batch);
+            source.read(&item[done], batch * sizeof(C));
+        }
+        return item;
+    } else {
+        unsigned char bytes[sizeof(T)];
+
+        source.read(bytes, sizeof bytes);
+        return from_bytes<T>(bytes);
+    }
+}
+
+/// Writes the items in [first, last). Contiguous trivially copyable items go
+/// out in one write; other trivially copyable items are gathered into chunks.
+template <class Sink, class InputIt>
+void write_items(Sink& sink, InputIt first, InputIt last) {
+    using T = typename std::iterator_traits<InputIt>::value_type;
+
+    if constexpr (std::is_pointer<InputIt>::value && std::is_trivially_copyable<T>::value) {
+        sink.write(first, (last - first) * sizeof(T));
+    } else if constexpr (std::is_trivially_copyable<T>::value) {
+        constexpr std::size_t chunk_items = sizeof(T) >= 4096 ? 1 : 4096 / sizeof(T);
+        alignas(T) unsigned char chunk[chunk_items * sizeof(T)];
+        std::size_t used = 0;
+
+        for (; first != last; ++first) {
+            std::memcpy(chunk + used * sizeof(T), std::addressof(*first), sizeof(T));
+            if (++used == chunk_items) {
+                sink.write(chunk, sizeof chunk);
+                used = 0;
+            }
+        }
+        sink.write(chunk, used * sizeof(T));
+    } else {
+        for (; first != last; ++first) {
+            write_item(sink, *first);
+        }
+    }
+}
+
+/// Reads count items of type T and writes them to out, for destinations
+/// with no contiguous storage to read into. Trivially copyable items are
+/// read in chunks of a fixed size, so memory is only committed as the data
+/// arrives, whatever count claims.
+template <class T, class Source, class OutputIt>
+void read_items(Source& source, std::uint64_t count, OutputIt out) {
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        constexpr std::size_t chunk_items = sizeof(T) >= 4096 ? 1 : 4096 / sizeof(T);
+        unsigned char chunk[chunk_items * sizeof(T)];
+
+        while (count > 0) {
+            const std::size_t batch = std::min<std::uint64_t>(count, chunk_items);
+
+            source.read(chunk, batch * sizeof(T));
+            for (std::size_t index = 0; index < batch; ++index) {
+                *out++ = from_bytes<T>(chunk + index * sizeof(T));
+            }
+            count -= batch;
+        }
+    } else {
+        for (; count > 0; --count) {
+            *out++ = read_item<T>(source);
+        }
+    }
+}
+
+}  // namespace serial
+
+#endif /* SERIALIZE_HPP */
+
+/* EOF */
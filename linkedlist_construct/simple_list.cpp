@@ -7,6 +7,7 @@
 #include <iostream>
 #include <cassert>
 #include "simple_list.h"
+#include "../common/BufferedWriter.hpp"
 
 /// initializes a list to empty
 void list_init(Node*& first, Node*& last) {
@@ -25,21 +26,22 @@ bool list_is_empty(const Node* first, const Node* last) {
 }
 
 /// prints a list in order using {1,2,3} format
-void list_print(const Node* first, const Node* last) {
+void list_print(const Node* first, const Node* /* last */) {
     const Node* current = first;
-    size_t i = 0;
 
     std::cout << '{';
 
+    BufferedWriter writer(std::cout);
+
     while (current != nullptr) {
-        std::cout << current->info;
-        i++;
-        if (i < list_size(first, last)) {
-            std::cout << ',';
+        if (current != first) {
+            writer.put(',');
         }
+        writer.write(current->info);
         current = current->link;
     }
-    std::cout << '}' << '\n';
+    writer.put('}');
+    writer.put('\n');
 }
 
 /// returns the number of elements (nodes) in a list
@@ -114,6 +116,7 @@ void list_insert_first(Node*& first, Node*& last, int item) {
 void list_insert_last(Node*& first, Node*& last, int item) {
     Node* newNode = new Node;
     newNode->info = item;
+    newNode->link = nullptr;
     // if empty list
     if (first == nullptr) {
         first = last = newNode;
@@ -203,17 +203,21 @@ TEST_CASE("void list_insert_last(Node*&, Node*&, int)") {
     CHECK(tail == head);
     CHECK(head->info == 65);
     CHECK(tail->info == 65);
+    CHECK(tail->link == nullptr);
 
     list_insert_last(head, tail, 66);
 
     CHECK(head != tail);
     CHECK(head->info == 65);
     CHECK(tail->info == 66);
+    CHECK(tail->link == nullptr);
 
     for (int i = 2; i <= 26; ++i) {
         list_insert_last(head, tail, i + 65);
         CHECK(tail->info == i + 65);
+        CHECK(tail->link == nullptr);
     }
+    CHECK(list_size(head, tail) == 27);
 
     while (head) { auto temp = head; head = head->link; delete temp; }
 }
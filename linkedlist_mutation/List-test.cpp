@@ -12,13 +12,23 @@
 #endif
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <initializer_list>
 #include <iomanip>
+#include <memory_resource>
 #include <sstream>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include "List.hpp"
 #include "List.hpp"  // check include guard
+#include "SlabAllocator.hpp"
+#include "SlabAllocator.hpp"  // check include guard
 
 TEMPLATE_TEST_CASE("List()", "", char, int, double) {
     List<TestType> list1{};
@@ -167,64 +177,138 @@ TEST_CASE("insert()") {
     REQUIRE(list1.size() == 3);
 
     // insert into middle of a list
-    list1.insert(list1.begin()->next->next, 67);
+    list1.insert(std::next(list1.begin(), 2), 67);
     REQUIRE(list1.size() == 4);
 
     // check forward linkage
-    REQUIRE(list1.begin()->prev == nullptr);
-    REQUIRE(list1.begin()->data == 65);
-    REQUIRE(list1.begin()->next != nullptr);
-    REQUIRE(list1.begin()->next->data == 66);
-    REQUIRE(list1.begin()->next->next != nullptr);
-    REQUIRE(list1.begin()->next->next->data == 67);
-    REQUIRE(list1.begin()->next->next->next != nullptr);
-    REQUIRE(list1.begin()->next->next->next->data == 68);
-    REQUIRE(list1.begin()->next->next->next->next == list1.end());
-
-    // check backward linkage
-    auto tail = list1.begin()->next->next->next;
-    REQUIRE(tail->next == list1.end());
-    REQUIRE(tail->data == 68);
-    REQUIRE(tail->prev != nullptr);
-    REQUIRE(tail->prev->data == 67);
-    REQUIRE(tail->prev->prev != nullptr);
-    REQUIRE(tail->prev->prev->data == 66);
-    REQUIRE(tail->prev->prev->prev != nullptr);
-    REQUIRE(tail->prev->prev->prev->data == 65);
-    REQUIRE(tail->prev->prev->prev->prev == nullptr);
+    auto itr = list1.begin();
+    REQUIRE(*itr == 65);
+    REQUIRE(*++itr == 66);
+    REQUIRE(*++itr == 67);
+    REQUIRE(*++itr == 68);
+    REQUIRE(++itr == list1.end());
+
+    // check backward linkage, starting from end()
+    REQUIRE(*--itr == 68);
+    REQUIRE(*--itr == 67);
+    REQUIRE(*--itr == 66);
+    REQUIRE(*--itr == 65);
+    REQUIRE(itr == list1.begin());
 }
 
 TEST_CASE("erase()") {
     List<int> list1 { 65, 66, 67, 68 };
 
-    REQUIRE(list1.begin()->prev == nullptr);
-    REQUIRE(list1.begin()->next->next->next->next == list1.end());
+    REQUIRE(std::next(list1.begin(), 4) == list1.end());
 
     // delete last element
-    list1.erase(list1.begin()->next->next->next);
-    REQUIRE(list1.begin()->next->next->next == list1.end());
-    REQUIRE(list1.begin()->next->next->data == 67);
-    REQUIRE(list1.begin()->next->next->prev->data == 66);
+    auto itr = list1.erase(std::prev(list1.end()));
+    REQUIRE(itr == list1.end());
+    REQUIRE(std::next(list1.begin(), 3) == list1.end());
+    REQUIRE(*std::next(list1.begin(), 2) == 67);
+    REQUIRE(*std::prev(list1.end(), 2) == 66);
     REQUIRE(list1.size() == 3);
 
     // delete middle element
-    list1.erase(list1.begin()->next);
+    itr = list1.erase(std::next(list1.begin()));
+    REQUIRE(*itr == 67);
     REQUIRE(list1.size() == 2);
-    REQUIRE(list1.begin()->next->next == list1.end());
-    REQUIRE(list1.begin()->next->data == 67);
-    REQUIRE(list1.begin()->next->prev->data == 65);
+    REQUIRE(std::next(list1.begin(), 2) == list1.end());
+    REQUIRE(*std::prev(itr) == 65);
 
     // delete front element
     list1.erase(list1.begin());
     REQUIRE(list1.size() == 1);
-    REQUIRE(list1.begin()->data == 67);
-    REQUIRE(list1.begin()->next == list1.end());
-    REQUIRE(list1.begin()->prev == nullptr);
+    REQUIRE(*list1.begin() == 67);
+    REQUIRE(std::next(list1.begin()) == list1.end());
+    REQUIRE(std::prev(list1.end()) == list1.begin());
 
     // delete final element, leaving empty container
     list1.erase(list1.begin());
     REQUIRE(list1.empty() == true);
     REQUIRE(list1.size() == 0);
+    REQUIRE(list1.begin() == list1.end());
+}
+
+TEMPLATE_TEST_CASE("const_iterator and reverse_iterator", "", char, int, double) {
+    using const_iterator = typename List<TestType>::const_iterator;
+
+    static_assert(std::is_same<decltype(*std::declval<const_iterator>()), const TestType&>::value,
+                  "const_iterator must not allow writes");
+    static_assert(std::is_convertible<typename List<TestType>::iterator, const_iterator>::value,
+                  "iterator must convert to const_iterator");
+    static_assert(!std::is_convertible<const_iterator, typename List<TestType>::iterator>::value,
+                  "const_iterator must not convert to iterator");
+
+    const std::vector<TestType> REF { 65, 66, 67, 68 };
+    List<TestType> list1 { 65, 66, 67, 68 };
+    const List<TestType>& view = list1;
+
+    const_iterator itr = list1.begin();
+    CHECK(itr == view.begin());
+    CHECK(itr == list1.cbegin());
+    CHECK(list1.begin() == view.cbegin());
+    CHECK(*--view.end() == 68);
+    CHECK(view.front() == 65);
+    CHECK(view.back() == 68);
+
+    CHECK(std::equal(list1.rbegin(), list1.rend(), REF.rbegin(), REF.rend()) == true);
+    CHECK(std::equal(view.crbegin(), view.crend(), REF.rbegin(), REF.rend()) == true);
+
+    *list1.rbegin() = 72;
+    CHECK(list1.back() == 72);
+
+    // positions may be given as const_iterators
+    list1.insert(view.begin(), 64);
+    list1.erase(std::prev(view.end()));
+    CHECK(list1 == List<TestType>{ 64, 65, 66, 67 });
+}
+
+TEST_CASE("checked iterators throw at the ends") {
+    List<int> list1 { 65, 66 };
+
+    if (List<int>::checked_iterators) {
+        CHECK_THROWS_AS(*list1.end(), std::logic_error);
+        CHECK_THROWS_AS(++list1.end(), std::logic_error);
+        CHECK_THROWS_AS(--list1.begin(), std::logic_error);
+        CHECK_THROWS_AS(list1.erase(list1.end()), std::logic_error);
+        CHECK_THROWS_AS(*List<int>::iterator(), std::logic_error);
+        CHECK(list1.size() == 2);
+    }
+    CHECK(*--list1.end() == 66);
+    CHECK(sizeof(List<int>::iterator) == sizeof(void*));
+}
+
+TEST_CASE("checked iterators stop at the end of the list their node is in") {
+    List<int> list1 { 65, 66 };
+    List<int> list2 { 67 };
+
+    // after a swap, itr walks the ring of list2
+    auto itr = std::next(list1.begin());
+    list1.swap(list2);
+    CHECK(*itr == 66);
+    CHECK(++itr == list2.end());
+    if (List<int>::checked_iterators) {
+        CHECK_THROWS_AS(*itr, std::logic_error);
+        CHECK_THROWS_AS(++itr, std::logic_error);
+    }
+
+    // a spliced node ends where its new list does
+    const auto moved = list2.begin();
+    list1.splice(list1.end(), list2, moved);
+    CHECK(list1 == List<int>{ 67, 65 });
+    CHECK(std::next(moved) == list1.end());
+    if (List<int>::checked_iterators) {
+        CHECK_THROWS_AS(*std::next(moved), std::logic_error);
+    }
+
+    // and so does one whose list was moved
+    List<int> list3 { std::move(list1) };
+    CHECK(std::next(moved) == list3.end());
+    if (List<int>::checked_iterators) {
+        CHECK_THROWS_AS(*std::next(moved), std::logic_error);
+        CHECK_THROWS_AS(*list1.end(), std::logic_error);
+    }
 }
 
 TEMPLATE_TEST_CASE("clear()", "", char, int, double) {
@@ -251,6 +335,243 @@ TEMPLATE_TEST_CASE("swap(List&)", "", char, int, double) {
     CHECK(std::equal(list2.begin(), list2.end(), REF.begin(), REF.end()) == true);
 }
 
+TEMPLATE_TEST_CASE("push_front(), push_back(), pop_front() and pop_back()", "", char, int, double) {
+    List<TestType> list1{};
+
+    list1.push_back(66);
+    list1.push_front(65);
+    const TestType value = 67;
+    list1.push_back(value);
+    CHECK(list1 == List<TestType>{ 65, 66, 67 });
+    CHECK(*std::prev(list1.end(), 2) == 66);
+
+    list1.pop_front();
+    CHECK(list1 == List<TestType>{ 66, 67 });
+    list1.pop_back();
+    CHECK(list1 == List<TestType>{ 66 });
+    CHECK(list1.front() == list1.back());
+    list1.pop_back();
+    CHECK(list1.empty() == true);
+    CHECK(list1.begin() == list1.end());
+
+    CHECK_THROWS_AS(list1.pop_front(), std::logic_error);
+    CHECK_THROWS_AS(list1.pop_back(), std::logic_error);
+}
+
+TEST_CASE("emplace() constructs the element inside the node") {
+    List<std::pair<std::string, int>> list1{};
+
+    auto itr = list1.emplace(list1.end(), "Bravo", 2);
+    CHECK((*itr).first == "Bravo");
+    CHECK(list1.emplace_front("Alpha", 1).second == 1);
+    CHECK(list1.emplace_back(std::string(3, 'C'), 3).first == "CCC");
+    list1.emplace(itr, "Between", 0);
+
+    CHECK(list1.size() == 4);
+    CHECK(list1.front().first == "Alpha");
+    CHECK(std::next(list1.begin())->first == "Between");
+    CHECK(list1.back().second == 3);
+}
+
+TEST_CASE("insert(iterator, value_type&&) moves the element") {
+    List<std::string> list1{};
+    std::string value(1000, 'A');
+    const char* const buffer = value.data();
+
+    list1.insert(list1.end(), std::move(value));
+    CHECK(list1.front().data() == buffer);
+
+    list1.push_back(std::string(1000, 'B'));
+    list1.push_front(list1.back());
+    CHECK(list1 == List<std::string>{ std::string(1000, 'B'), std::string(1000, 'A'),
+                                      std::string(1000, 'B') });
+}
+
+TEMPLATE_TEST_CASE("insert() of a range", "", char, int, double) {
+    const std::vector<TestType> REF { 67, 68, 69 };
+    List<TestType> list1 { 65, 66, 70 };
+
+    auto itr = list1.insert(std::next(list1.begin(), 2), REF.begin(), REF.end());
+    CHECK(*itr == 67);
+    CHECK(list1 == List<TestType>{ 65, 66, 67, 68, 69, 70 });
+    CHECK(list1.size() == 6);
+
+    itr = list1.insert(list1.end(), { 71, 72 });
+    CHECK(*itr == 71);
+    CHECK(list1.back() == 72);
+    CHECK(*std::prev(list1.end(), 3) == 70);
+
+    itr = list1.insert(list1.begin(), REF.end(), REF.end());
+    CHECK(itr == list1.begin());
+    CHECK(list1.size() == 8);
+}
+
+TEST_CASE("insert() of a range leaves the list unchanged if an element throws") {
+    struct Fragile {
+        Fragile(int value) : value(value) {
+            if (value < 0) {
+                throw std::runtime_error("negative");
+            }
+        }
+        int value;
+    };
+
+    List<Fragile> list1{};
+    list1.emplace_back(1);
+
+    const std::vector<int> VALUES { 2, 3, -1, 4 };
+    CHECK_THROWS_AS(list1.insert(list1.end(), VALUES.begin(), VALUES.end()), std::runtime_error);
+    CHECK(list1.size() == 1);
+    CHECK(list1.back().value == 1);
+    CHECK(std::next(list1.begin()) == list1.end());
+}
+
+TEMPLATE_TEST_CASE("List& operator=(const List&) reuses the nodes it has", "", char, int, double) {
+    const List<TestType> SHORT { 70, 71 };
+    const List<TestType> LONG { 72, 73, 74, 75, 76 };
+
+    List<TestType> list1 { 65, 66, 67, 68 };
+    auto* const first = &*list1.begin();
+
+    list1 = SHORT;
+    CHECK(list1 == SHORT);
+    CHECK(&*list1.begin() == first);
+    CHECK(list1.back() == 71);
+
+    list1 = LONG;
+    CHECK(list1 == LONG);
+    CHECK(&*list1.begin() == first);
+    CHECK(list1.size() == 5);
+}
+
+TEMPLATE_TEST_CASE("splice()", "", char, int, double) {
+    List<TestType> list1 { 65, 66, 67 };
+    List<TestType> list2 { 70, 71, 72, 73 };
+
+    // a single node, from the middle of another list to the front
+    auto* const moved = &*std::next(list2.begin());
+    list1.splice(list1.begin(), list2, std::next(list2.begin()));
+    CHECK(list1 == List<TestType>{ 71, 65, 66, 67 });
+    CHECK(list2 == List<TestType>{ 70, 72, 73 });
+    CHECK(&*list1.begin() == moved);
+
+    // a range, to the back; the tail of list2 goes along
+    list1.splice(list1.end(), list2, std::next(list2.begin()), list2.end());
+    CHECK(list1 == List<TestType>{ 71, 65, 66, 67, 72, 73 });
+    CHECK(list2 == List<TestType>{ 70 });
+    CHECK(list1.size() == 6);
+    CHECK(list2.size() == 1);
+    CHECK(list1.back() == 73);
+    CHECK(list2.back() == 70);
+
+    // a range within the same list
+    list1.splice(list1.begin(), list1, std::next(list1.begin(), 4), list1.end());
+    CHECK(list1 == List<TestType>{ 72, 73, 71, 65, 66, 67 });
+    CHECK(list1.size() == 6);
+
+    // a node onto itself does nothing
+    list1.splice(list1.begin(), list1, list1.begin());
+    CHECK(list1.front() == 72);
+
+    // a whole list, into the middle
+    list1.splice(std::next(list1.begin()), list2);
+    CHECK(list1 == List<TestType>{ 72, 70, 73, 71, 65, 66, 67 });
+    CHECK(list2.empty() == true);
+    CHECK(list2.begin() == list2.end());
+    CHECK(list1.size() == 7);
+}
+
+TEST_CASE("splice() between lists with unequal allocators") {
+    std::pmr::monotonic_buffer_resource arena{};
+
+    pmr::List<int> list1 { 1, 2, 3 };
+    pmr::List<int> list2({ 4, 5 }, &arena);
+
+    CHECK_THROWS_AS(list1.splice(list1.end(), list2), std::invalid_argument);
+    CHECK(list1.size() == 3);
+    CHECK(list2.size() == 2);
+}
+
+TEMPLATE_TEST_CASE("sort()", "", char, int, double) {
+    List<TestType> list1{};
+    std::vector<TestType> ref{};
+
+    for (int i = 0; i < 1000; ++i) {
+        const TestType value = TestType((i * 37) % 101);
+
+        list1.insert(list1.end(), value);
+        ref.push_back(value);
+    }
+
+    // sorting relinks the nodes already there
+    std::vector<const TestType*> nodes{};
+    for (const auto& item : list1) {
+        nodes.push_back(&item);
+    }
+
+    list1.sort();
+    std::sort(ref.begin(), ref.end());
+    CHECK(std::equal(list1.begin(), list1.end(), ref.begin(), ref.end()) == true);
+    CHECK(list1.size() == ref.size());
+    CHECK(list1.back() == ref.back());
+    CHECK(*std::prev(std::next(list1.begin())) == ref.front());
+    CHECK(*list1.rbegin() == ref.back());
+
+    std::vector<const TestType*> sorted{};
+    for (const auto& item : list1) {
+        sorted.push_back(&item);
+    }
+    std::sort(nodes.begin(), nodes.end());
+    std::sort(sorted.begin(), sorted.end());
+    CHECK(nodes == sorted);
+
+    list1.sort(std::greater<>());
+    CHECK(std::equal(list1.begin(), list1.end(), ref.rbegin(), ref.rend()) == true);
+}
+
+TEST_CASE("sort() keeps equal elements in order") {
+    List<std::string> list1 { "bb", "a", "cc", "b", "aa", "c", "dd", "d" };
+
+    list1.sort([](const std::string& lhs, const std::string& rhs) {
+        return lhs.size() < rhs.size();
+    });
+    CHECK(list1 == List<std::string>{ "a", "b", "c", "d", "bb", "cc", "aa", "dd" });
+}
+
+TEMPLATE_TEST_CASE("merge()", "", char, int, double) {
+    List<TestType> list1 { 65, 67, 69, 71 };
+    List<TestType> list2 { 66, 67, 68, 72, 73 };
+
+    list1.merge(list2);
+    CHECK(list1 == List<TestType>{ 65, 66, 67, 67, 68, 69, 71, 72, 73 });
+    CHECK(list1.size() == 9);
+    CHECK(list1.back() == 73);
+    CHECK(list2.empty() == true);
+    CHECK(list2.size() == 0);
+
+    // merging an empty list, or into one
+    list1.merge(list2);
+    CHECK(list1.size() == 9);
+    list2.merge(list1);
+    CHECK(list2.size() == 9);
+    CHECK(list1.empty() == true);
+}
+
+TEMPLATE_TEST_CASE("unique()", "", char, int, double) {
+    List<TestType> list1 { 65, 65, 66, 67, 67, 67, 65, 68, 68 };
+
+    CHECK(list1.unique() == 4);
+    CHECK(list1 == List<TestType>{ 65, 66, 67, 65, 68 });
+    CHECK(list1.back() == 68);
+
+    // with a predicate: drop elements within 1 of the last kept one
+    CHECK(list1.unique([](TestType lhs, TestType rhs) { return rhs - lhs <= 1 && lhs - rhs <= 1; }) == 1);
+    CHECK(list1 == List<TestType>{ 65, 67, 65, 68 });
+
+    List<TestType> list2{};
+    CHECK(list2.unique() == 0);
+}
+
 TEMPLATE_TEST_CASE("bool operator==(const List&, const List&)", "", char, int, double) {
     const List<TestType> REF { 65, 66, 67, 68, 69, 70, 71, 72 };
 
@@ -260,7 +581,7 @@ TEMPLATE_TEST_CASE("bool operator==(const List&, const List&)", "", char, int, d
 
     CHECK((list1 == list2) == true);
 
-    list2.begin()->next->next->next->next->next->next->data = 42;
+    *std::next(list2.begin(), 6) = 42;
     CHECK((list1 == list2) == false);
 
     list3.insert(list3.end(), 42);
@@ -276,7 +597,7 @@ TEMPLATE_TEST_CASE("bool operator!=(const List&, const List&)", "", char, int, d
 
     CHECK((list1 != list2) == false);
 
-    list2.begin()->next->next->next->data = 42;
+    *std::next(list2.begin(), 3) = 42;
     CHECK((list1 != list2) == true);
 
     list3.insert(list3.end(), 42);
@@ -360,5 +681,239 @@ TEST_CASE("std::ostream& operator<<(std::ostream&, const List<std::string>&)") {
     CHECK(output.str() == "{Alpha,Bravo,Charlie,Delta,Echo,Foxtrot,Golf}");
 }
 
+TEMPLATE_TEST_CASE("save() and load() with streams", "", char, int, double) {
+    List<TestType> list1{};
+
+    for (int i = 0; i < 5000; ++i) {
+        list1.insert(list1.end(), TestType(i % 100));
+    }
+
+    std::stringstream stream{};
+    save(stream, list1);
+    save(stream, List<TestType>{});
+
+    List<TestType> list2 { 1, 2, 3 };
+    List<TestType> list3 { 4 };
+    load(stream, list2);
+    load(stream, list3);
+
+    CHECK(list2 == list1);
+    CHECK(list3.empty() == true);
+    CHECK_THROWS_AS(load(stream, list3), std::runtime_error);
+}
+
+TEMPLATE_TEST_CASE("save() and load() with buffers", "", char, int, double) {
+    const List<TestType> REF1 { 65, 66, 67, 68, 69, 70, 71, 72 };
+    const List<TestType> REF2 { 42 };
+
+    std::vector<char> buffer{};
+    save(buffer, REF1);
+    save(buffer, REF2);
+
+    List<TestType> list1{};
+    List<TestType> list2{};
+    const char* last = buffer.data() + buffer.size();
+    const char* next = load(buffer.data(), last, list1);
+    next = load(next, last, list2);
+
+    CHECK(list1 == REF1);
+    CHECK(list2 == REF2);
+    CHECK(next == last);
+}
+
+TEST_CASE("save() and load() with List<std::string>") {
+    const List<std::string> REF { "Alpha", "", std::string(1000, 'B'), "Charlie" };
+
+    std::vector<char> buffer{};
+    save(buffer, REF);
+
+    List<std::string> list1{};
+    load(buffer.data(), buffer.data() + buffer.size(), list1);
+    CHECK(list1 == REF);
+
+    // a Container snapshot is not a List snapshot
+    buffer[0] = 'C';
+    CHECK_THROWS_AS(load(buffer.data(), buffer.data() + buffer.size(), list1),
+                    std::runtime_error);
+    CHECK(list1 == REF);
+}
+
+namespace {
+// trivially copyable element type with no default ctor
+struct Tag {
+    explicit Tag(int v) : value(v) {}
+    int value;
+
+    friend bool operator==(const Tag& lhs, const Tag& rhs) { return lhs.value == rhs.value; }
+    friend std::ostream& operator<<(std::ostream& output, const Tag& tag) {
+        return output << tag.value;
+    }
+};
+}  // namespace
+
+TEST_CASE("load() bounds what a corrupt count allocates") {
+    List<Tag> REF{};
+    for (int i = 0; i < 2000; ++i) {
+        REF.emplace_back(i);
+    }
+
+    // items without a default ctor load like any other
+    std::vector<char> buffer{};
+    save(buffer, REF);
+
+    List<Tag> list1{};
+    load(buffer.data(), buffer.data() + buffer.size(), list1);
+    CHECK(list1 == REF);
+
+    // claim far more items than follow
+    const std::uint64_t count = std::uint64_t(1) << 60;
+    std::memcpy(buffer.data() + offsetof(serial::Header, count), &count, sizeof count);
+
+    std::stringstream stream(std::string(buffer.begin(), buffer.end()));
+    CHECK_THROWS_AS(load(stream, list1), std::runtime_error);
+    CHECK(list1 == REF);
+
+    // the same goes for the length of a string
+    std::vector<char> strings{};
+    save(strings, List<std::string>{ "Alpha" });
+    std::memcpy(strings.data() + sizeof(serial::Header), &count, sizeof count);
+
+    List<std::string> list2{};
+    stream.clear();
+    stream.str(std::string(strings.begin(), strings.end()));
+    CHECK_THROWS_AS(load(stream, list2), std::runtime_error);
+}
+
+TEMPLATE_TEST_CASE("pmr::List allocates its nodes from its resource", "", char, int, double) {
+    alignas(std::max_align_t) unsigned char buffer[16384];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof buffer,
+                                              std::pmr::null_memory_resource());
+
+    pmr::List<TestType> list1(&arena);
+    for (int i = 0; i < 100; ++i) {
+        list1.insert(list1.end(), TestType(65 + i % 26));
+    }
+    REQUIRE(list1.size() == 100);
+    CHECK(list1.get_allocator().resource() == &arena);
+
+    // copies use the default resource unless they are given one
+    pmr::List<TestType> list2(list1, &arena);
+    CHECK(list2 == list1);
+    CHECK(list2.get_allocator().resource() == &arena);
+
+    const pmr::List<TestType> list3 { list1 };
+    CHECK(list3.get_allocator().resource() == std::pmr::get_default_resource());
+
+    // moving between resources copies the nodes across
+    pmr::List<TestType> list4{};
+    list4 = std::move(list2);
+    CHECK(list4 == list1);
+    CHECK(list4.get_allocator().resource() == std::pmr::get_default_resource());
+    CHECK(list2.empty() == true);
+}
+
+TEMPLATE_TEST_CASE("SlabList takes its nodes from slabs and recycles them", "", char, int, double) {
+    SlabList<TestType> list1{};
+    const auto pool = list1.get_allocator().pool();
+
+    for (int i = 0; i < 1000; ++i) {
+        list1.insert(list1.end(), TestType(65 + i % 26));
+    }
+    REQUIRE(list1.size() == 1000);
+    CHECK(pool->live() == 1000);
+    CHECK(pool->slab_count() == (1000 + SlabPool::default_slab_items - 1) / SlabPool::default_slab_items);
+
+    // an erased node is the next one handed out
+    auto* const second = &*std::next(list1.begin());
+    list1.erase(std::next(list1.begin()));
+    CHECK(pool->live() == 999);
+    CHECK(&*list1.insert(list1.begin(), TestType(42)) == second);
+
+    // the copy keeps its nodes in a pool of its own
+    const SlabList<TestType> list2 { list1 };
+    CHECK(list2 == list1);
+    CHECK(list2.get_allocator() != list1.get_allocator());
+    CHECK(pool->live() == 1000);
+
+    // clear() drops the slabs wholesale
+    list1.clear();
+    CHECK(list1.empty() == true);
+    CHECK(pool->live() == 0);
+    CHECK(pool->slab_count() == 0);
+
+    list1.insert(list1.end(), TestType(66));
+    CHECK(list1.front() == TestType(66));
+    CHECK(pool->slab_count() == 1);
+}
+
+TEMPLATE_TEST_CASE("SlabList can share a pool between lists", "", char, int, double) {
+    const SlabAllocator<TestType> shared(std::make_shared<SlabPool>(16));
+
+    SlabList<TestType> list1(shared);
+    SlabList<TestType> list2(shared);
+
+    for (int i = 0; i < 40; ++i) {
+        list1.insert(list1.end(), TestType(65 + i % 26));
+        list2.insert(list2.begin(), TestType(65 + i % 26));
+    }
+    CHECK(shared.pool()->live() == 80);
+    CHECK(shared.pool()->slab_count() == 5);
+
+    // list2 still holds nodes, so list1 must free its own one at a time
+    list1.clear();
+    CHECK(shared.pool()->live() == 40);
+    CHECK(shared.pool()->slab_count() == 5);
+    CHECK(list2.size() == 40);
+    CHECK(list2.back() == TestType(65));
+
+    // moving keeps the pool, and the moved-from list can be refilled
+    SlabList<TestType> list3 { std::move(list2) };
+    CHECK(list3.get_allocator() == shared);
+    list2.insert(list2.end(), TestType(67));
+    CHECK(list2.size() == 1);
+}
+
+TEST_CASE("SlabList of another node size does not release a shared pool") {
+    using Wide = std::array<double, 4>;
+
+    const std::initializer_list<int> REF { 65, 66, 67 };
+    const auto pool = std::make_shared<SlabPool>(16);
+    SlabList<int> list1 { SlabAllocator<int>(pool) };
+    SlabList<Wide> list2 { SlabAllocator<Wide>(pool) };
+
+    // the first list sets the block size, so the wider nodes bypass the slabs
+    for (int i = 0; i < 3; ++i) {
+        list1.insert(list1.end(), 65 + i);
+        list2.insert(list2.end(), Wide{ 1.0 * i, 2.0, 3.0, 4.0 });
+    }
+    REQUIRE(pool->live() == 3);
+    REQUIRE(list2.size() == pool->live());
+
+    // equal counts must not let list2 drop the slabs holding list1
+    list2.clear();
+    CHECK(list2.empty() == true);
+    CHECK(pool->live() == 3);
+    CHECK(pool->slab_count() == 1);
+    CHECK(std::equal(list1.begin(), list1.end(), REF.begin(), REF.end()) == true);
+
+    list1.clear();
+    CHECK(pool->live() == 0);
+    CHECK(pool->slab_count() == 0);
+}
+
+TEST_CASE("SlabList<std::string> destroys its elements") {
+    const List<std::string> REF { "Alpha", std::string(1000, 'B'), "Charlie" };
+
+    SlabList<std::string> list1{};
+    for (const auto& item : REF) {
+        list1.insert(list1.end(), item);
+    }
+    CHECK(std::equal(list1.begin(), list1.end(), REF.begin(), REF.end()) == true);
+
+    list1.erase(list1.begin());
+    list1.clear();
+    CHECK(list1.get_allocator().pool()->live() == 0);
+}
+
 /* EOF */
 
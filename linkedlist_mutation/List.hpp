@@ -13,71 +13,139 @@
 #include <initializer_list>
 #include <iterator>
 #include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "../common/Serialize.hpp"
+#include "../common/BufferedWriter.hpp"
+
+// Checked iterators throw std::logic_error instead of stepping or reading
+// past either end of a List, or through a default-constructed iterator.
+// They are on unless NDEBUG is defined. An iterator is a bare pointer either
+// way; checked builds add a flag to every link that marks the sentinel. The
+// setting must match in every translation unit.
+#ifndef LIST_CHECKED_ITERATORS
+#ifdef NDEBUG
+#define LIST_CHECKED_ITERATORS 0
+#else
+#define LIST_CHECKED_ITERATORS 1
+#endif
+#endif
 
-template <class T>
+namespace detail {
+
+// checks whether Alloc offers release(live), which frees all of its storage
+// at once if live blocks are all that is still out, e.g. SlabAllocator
+template <class Alloc, class = void>
+struct has_release : std::false_type {};
+
+template <class Alloc>
+struct has_release<Alloc, std::void_t<decltype(std::declval<Alloc&>().release(std::size_t{}))>>
+: std::true_type {};
+
+// what a List link knows besides its neighbours: in checked builds, whether
+// it is the sentinel. Nodes move between lists in swap() and splice(), so a
+// checked iterator asks the link it is at rather than remembering an end.
+template <bool Checked>
+struct SentinelFlag {
+    SentinelFlag() = default;
+    explicit SentinelFlag(bool) {}
+    bool is_sentinel() const { return false; }
+};
+
+template <>
+struct SentinelFlag<true> {
+    SentinelFlag() = default;
+    explicit SentinelFlag(bool sentinel) : sentinel(sentinel) {}
+    bool is_sentinel() const { return sentinel; }
+
+    bool sentinel = false;  ///< true only for the sentinel of a List
+};
+
+}  // namespace detail
+
+// Nodes come from Allocator rebound to the node type, so a List can live on
+// a std::pmr resource (see pmr::List below) instead of the global heap.
+//
+// The nodes form a ring through a sentinel that holds no element: end() is
+// the sentinel, so --end() is the last element, and inserting or erasing
+// anywhere is the same four pointer writes.
+template <class T, class Allocator = std::allocator<T>>
 class List {
 private:
-    struct Node {
-        T     data{};  ///< value stored in the Node
-        Node* prev{};  ///< pointer to the previous Node
-        Node* next{};  ///< pointer to the next Node
+    struct Links : detail::SentinelFlag<LIST_CHECKED_ITERATORS> {
+        Links* prev{};  ///< pointer to the previous Node, or the sentinel
+        Links* next{};  ///< pointer to the next Node, or the sentinel
+    };
+
+    struct Node : Links {
+        template <class... Args>
+        explicit Node(Args&&... args) : data(std::forward<Args>(args)...) {}
+
+        T data{};  ///< value stored in the Node
     };
+
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using node_traits    = std::allocator_traits<node_allocator>;
+
 public:
+    // whether iterators check their bounds (see LIST_CHECKED_ITERATORS)
+    static constexpr bool checked_iterators = LIST_CHECKED_ITERATORS;
+
+    template <bool Const>
     class Iterator {
     public:
         // member types
         using iterator_category = std::bidirectional_iterator_tag;
         using value_type        = T;
         using difference_type   = std::ptrdiff_t;
-        using pointer           = Node*;
-        using reference         = value_type&;
+        using pointer           = std::conditional_t<Const, const value_type*, value_type*>;
+        using reference         = std::conditional_t<Const, const value_type&, value_type&>;
+
+        Iterator() = default;
 
-        Iterator(pointer ptr = nullptr)
-        : current(ptr)
+        // an iterator converts to a const_iterator
+        template <bool C = Const, class = std::enable_if_t<C>>
+        Iterator(const Iterator<false>& other)
+        : current(other.current)
         {}
 
         reference operator*() const {
-            if (current == nullptr) {
-                throw std::logic_error("error: dereferencing nullptr");
-            }
-            return current->data;
+            check(current);
+            return static_cast<Node*>(current)->data;
         }
 
-        pointer operator->() {
-            return current;
+        pointer operator->() const {
+            return &**this;
         }
 
         Iterator& operator++() {
-            if (current == nullptr) {
-                throw std::logic_error("error: dereferencing nullptr");
-            }
+            check(current);
             current = current->next;
             return *this;
         }
 
         Iterator operator++(int) {
-            if (current == nullptr) {
-                throw std::logic_error("error: dereferencing nullptr");
-            }
             Iterator tmp = *this;
-            current = current->next;
+            ++*this;
             return tmp;
         }
 
         Iterator& operator--() {
-            if (current == nullptr) {
-                throw std::logic_error("error: dereferencing nullptr");
-            }
+            check(current != nullptr ? current->prev : nullptr);
             current = current->prev;
             return *this;
         }
 
         Iterator operator--(int) {
-            if (current == nullptr) {
-                throw std::logic_error("error: dereferencing nullptr");
-            }
             Iterator tmp = *this;
-            current = current->prev;
+            --*this;
             return tmp;
         }
 
@@ -90,207 +158,734 @@ public:
         }
 
     private:
-        pointer current{};
+        friend class List;
+        friend class Iterator<!Const>;
+
+        explicit Iterator(Links* current)
+        : current(current)
+        {}
+
+        // in checked builds, throws unless at is an element of a list
+        void check(const Links* at) const {
+            if constexpr (checked_iterators) {
+                if (at == nullptr) {
+                    throw std::logic_error("error: dereferencing nullptr");
+                }
+                if (at->is_sentinel()) {
+                    throw std::logic_error("error: iterator out of range");
+                }
+            }
+        }
+
+        Links* current{};  ///< Node, or sentinel for end()
     };
 
     // Member types
-    using value_type = T;
-    using size_type  = std::size_t;
-    using reference  = value_type&;
-    using iterator   = Iterator;
+    using value_type             = T;
+    using allocator_type         = Allocator;
+    using size_type              = std::size_t;
+    using reference              = value_type&;
+    using const_reference        = const value_type&;
+    using iterator               = Iterator<false>;
+    using const_iterator         = Iterator<true>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
     List() = default;
+    explicit List(const allocator_type& alloc) : alloc(alloc) {}
     List(const List& other);
+    List(const List& other, const allocator_type& alloc);
     List(List&& other);
-    List(const std::initializer_list<value_type>& ilist);
+    List(const std::initializer_list<value_type>& ilist,
+         const allocator_type& alloc = allocator_type());
     virtual ~List();
     List& operator=(const List& rhs);
     List& operator=(List&& rhs);
     reference front();
+    const_reference front() const;
     reference back();
-    iterator begin() const { return iterator(head); }
-    iterator end() const { return iterator(); }
-    bool empty() const { return begin() == end(); }
+    const_reference back() const;
+    void push_front(const value_type& value) { emplace_front(value); }
+    void push_front(value_type&& value) { emplace_front(std::move(value)); }
+    void push_back(const value_type& value) { emplace_back(value); }
+    void push_back(value_type&& value) { emplace_back(std::move(value)); }
+    template <class... Args>
+    reference emplace_front(Args&&... args) { return *emplace(begin(), std::forward<Args>(args)...); }
+    template <class... Args>
+    reference emplace_back(Args&&... args) { return *emplace(end(), std::forward<Args>(args)...); }
+    void pop_front();
+    void pop_back();
+    iterator begin() { return make_iterator(sentinel.next); }
+    const_iterator begin() const { return make_iterator(sentinel.next); }
+    const_iterator cbegin() const { return begin(); }
+    iterator end() { return make_iterator(&sentinel); }
+    const_iterator end() const { return make_iterator(&sentinel); }
+    const_iterator cend() const { return end(); }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const { return rbegin(); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const { return rend(); }
+    bool empty() const { return count == 0; }
     size_type size() const { return count; }
     void clear();
-    iterator insert(iterator pos, const value_type& value);
-    iterator erase(iterator pos);
+    iterator insert(const_iterator pos, const value_type& value) { return emplace(pos, value); }
+    iterator insert(const_iterator pos, value_type&& value) { return emplace(pos, std::move(value)); }
+    template <class InputIt>
+    iterator insert(const_iterator pos, InputIt first, InputIt last);
+    iterator insert(const_iterator pos, std::initializer_list<value_type> ilist);
+    template <class... Args>
+    iterator emplace(const_iterator pos, Args&&... args);
+    iterator erase(const_iterator pos);
     void swap(List& other);
+    allocator_type get_allocator() const { return allocator_type(alloc); }
+
+    // Reordering by relinking: no node is allocated, copied or freed, and
+    // iterators stay valid (spliced ones now point into this list). Lists
+    // exchanging nodes must have equal allocators.
+    void splice(const_iterator pos, List& other);
+    void splice(const_iterator pos, List& other, const_iterator it);
+    void splice(const_iterator pos, List& other, const_iterator first, const_iterator last);
+    void merge(List& other);
+    template <class Compare>
+    void merge(List& other, Compare comp);
+    void sort();
+    template <class Compare>
+    void sort(Compare comp);
+    size_type unique();
+    template <class BinaryPredicate>
+    size_type unique(BinaryPredicate pred);
 
 protected:
-    Node*     head{};   ///< pointer to the head node
-    Node*     tail{};   ///< pointer to the tail node
-    size_type count{};  ///< number of nodes in list
+    Links          sentinel{detail::SentinelFlag<LIST_CHECKED_ITERATORS>(true),
+                            &sentinel, &sentinel};  ///< ring anchor: next is the head, prev the tail
+    size_type      count{};                         ///< number of nodes in list
+    node_allocator alloc{};                         ///< source of the nodes
+
+private:
+    // returns an iterator to node, which is in this list or is the sentinel
+    iterator make_iterator(Links* node) { return iterator(node); }
+    const_iterator make_iterator(const Links* node) const {
+        return const_iterator(const_cast<Links*>(node));
+    }
+
+    // returns the element of a node
+    static T& value_of(Links* node) { return static_cast<Node*>(node)->data; }
+
+    // allocates a node whose element is constructed from args
+    template <class... Args>
+    Node* make_node(Args&&... args);
+
+    // destroys node and returns it to the allocator
+    void free_node(Links* node);
+
+    // throws unless other's nodes may become ours
+    void check_splice(const List& other) const;
+
+    // unlinks the nodes [first, last] from the list; their own links are kept
+    static void unlink_nodes(Links* first, Links* last);
+
+    // links the chain of nodes [first, last] in before pos
+    static void link_nodes(Links* pos, Links* first, Links* last);
+
+    // empties the ring, leaving the sentinel linked to itself
+    void reset_links();
+
+    // takes over the nodes of other, which is left empty
+    void take_links(List& other);
+
+    // closes the chain starting at sentinel.next, which ends in nullptr and
+    // whose prev pointers are stale, into a ring
+    void relink_backward();
+
+    // merges two sorted chains linked through next, taking from first on ties
+    template <class Compare>
+    static Links* merge_chains(Links* first, Links* second, Compare& comp);
 };
 
-/** NON-MEMBER TEMPLATE FUNCTIONS **/
-template <class T>
-bool operator==(const List<T>& lhs, const List<T>& rhs);
+namespace pmr {
 
+// a List whose nodes come from a std::pmr::memory_resource, e.g. a
+// monotonic_buffer_resource released in one shot, or an unsynchronized pool
 template <class T>
-bool operator!=(const List<T>& lhs, const List<T>& rhs);
+using List = ::List<T, std::pmr::polymorphic_allocator<T>>;
 
-template <class T>
-std::ostream& operator<<(std::ostream& output, const List<T>& list);
+}  // namespace pmr
+
+/** NON-MEMBER TEMPLATE FUNCTIONS **/
+template <class T, class A>
+bool operator==(const List<T, A>& lhs, const List<T, A>& rhs);
+
+template <class T, class A>
+bool operator!=(const List<T, A>& lhs, const List<T, A>& rhs);
+
+template <class T, class A>
+std::ostream& operator<<(std::ostream& output, const List<T, A>& list);
+
+// writes a binary snapshot of list to output, or appends it to buffer
+template <class T, class A>
+void save(std::ostream& output, const List<T, A>& list);
+
+template <class T, class A>
+void save(std::vector<char>& buffer, const List<T, A>& list);
+
+// replaces list with a snapshot read from input or from [first, last);
+// list is unchanged if the snapshot is malformed. The buffer form returns
+// the first byte after the snapshot.
+template <class T, class A>
+void load(std::istream& input, List<T, A>& list);
+
+template <class T, class A>
+const char* load(const char* first, const char* last, List<T, A>& list);
 
 // copy constructor
-template <class T>
-List<T>::List(const List<T>& other) {
-    *this = other;
+template <class T, class A>
+List<T, A>::List(const List<T, A>& other)
+: List(other, std::allocator_traits<A>::select_on_container_copy_construction(
+                  other.get_allocator())) {}
+
+// copy constructor using alloc
+template <class T, class A>
+List<T, A>::List(const List<T, A>& other, const allocator_type& alloc)
+: alloc(alloc) {
+    insert(end(), other.begin(), other.end());
 }
 
 // move constructor
-template <class T>
-List<T>::List(List<T>&& other) {
-    head = (std::exchange(other.head, nullptr));
-    tail = (std::exchange(other.tail, nullptr));
-    count = (std::exchange(other.count, 0));
+template <class T, class A>
+List<T, A>::List(List<T, A>&& other) : alloc(std::move(other.alloc)) {
+    take_links(other);
 }
 
 // list initializer
-template <class T>
-List<T>::List(const std::initializer_list<value_type>& ilist) {
-    for (auto& itr : ilist) {
-        List<T>::insert(end(), itr);
-    }
+template <class T, class A>
+List<T, A>::List(const std::initializer_list<value_type>& ilist, const allocator_type& alloc)
+: alloc(alloc) {
+    insert(end(), ilist.begin(), ilist.end());
 }
 
 // destructor
-template <class T>
-List<T>::~List() {
+template <class T, class A>
+List<T, A>::~List() {
     clear();
 }
 
 // copy assignment operator
-template <class T>
-List<T>& List<T>::operator=(const List<T>& rhs) {
+template <class T, class A>
+List<T, A>& List<T, A>::operator=(const List<T, A>& rhs) {
     if (this != &rhs) {
-        clear();
+        if constexpr (node_traits::propagate_on_container_copy_assignment::value) {
+            if (alloc != rhs.alloc) {
+                clear(); // our nodes must go back to our allocator
+            }
+            alloc = rhs.alloc;
+        }
+
+        // reuse the nodes we have, then add or drop the difference
+        iterator dest = begin();
+        const_iterator source = rhs.begin();
 
-        for (auto& itr : rhs) {
-            insert(end(), itr);
+        for (; dest != end() && source != rhs.end(); ++dest, ++source) {
+            *dest = *source;
+        }
+        if (source != rhs.end()) {
+            insert(end(), source, rhs.end());
+        }
+        while (dest != end()) {
+            dest = erase(dest);
         }
     }
     return *this;
 }
 
 // move assignment operator
-template <class T>
-List<T>& List<T>::operator=(List<T>&& rhs) {
+template <class T, class A>
+List<T, A>& List<T, A>::operator=(List<T, A>&& rhs) {
     if (this != &rhs) {
         clear();
 
-        head = std::exchange(rhs.head, nullptr);
-        tail = std::exchange(rhs.tail, nullptr);
-        count = std::exchange(rhs.count, 0);
+        if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+            alloc = std::move(rhs.alloc);
+        } else if (alloc != rhs.alloc) {
+            // our allocator cannot free rhs's nodes: move their elements instead
+            for (auto& itr : rhs) {
+                emplace_back(std::move(itr));
+            }
+            rhs.clear();
+            return *this;
+        }
+
+        take_links(rhs);
     }
     return *this;
 }
 
 // returns first element of the list
-template <class T>
-typename List<T>::reference List<T>::front() {
-    return !empty() ? head->data : throw std::logic_error("empty list");
+template <class T, class A>
+typename List<T, A>::reference List<T, A>::front() {
+    return !empty() ? value_of(sentinel.next) : throw std::logic_error("empty list");
+}
+
+template <class T, class A>
+typename List<T, A>::const_reference List<T, A>::front() const {
+    return !empty() ? value_of(sentinel.next) : throw std::logic_error("empty list");
 }
 
 // returns the last element of the list
-template <class T>
-typename List<T>::reference List<T>::back() {
-    return !empty() ? tail->data : throw std::logic_error("empty list");
+template <class T, class A>
+typename List<T, A>::reference List<T, A>::back() {
+    return !empty() ? value_of(sentinel.prev) : throw std::logic_error("empty list");
 }
 
-template <class T>
-void List<T>::clear() {
-    while (!empty()) {
-        erase(begin());
+template <class T, class A>
+typename List<T, A>::const_reference List<T, A>::back() const {
+    return !empty() ? value_of(sentinel.prev) : throw std::logic_error("empty list");
+}
+
+// removes the first element of the list
+template <class T, class A>
+void List<T, A>::pop_front() {
+    if (empty()) {
+        throw std::logic_error("empty list");
     }
+    erase(begin());
 }
 
-// inserts a new node into the list
-template <class T>
-typename List<T>::iterator
-List<T>::insert(List<T>::iterator pos, const value_type& value) {
-    Node* const newNode = new Node{value}; // new node to be inserted
-    if (empty()) { // if empty, new node is the only node
-        head = tail = newNode;
-    } else if (pos == begin()) { // if inserting at beginning
-        newNode->next = head;
-        head->prev = newNode;
-        head = newNode;
-    } else if (pos == end()) { // if inserting at the end
-        newNode->prev = tail;
-        tail->next = newNode;
-        tail = newNode;
-    } else { // if inserting anywhere else in the list
-        newNode->next = pos->prev->next;
-        newNode->prev = pos->prev;
-        pos->prev->next = newNode;
-        pos->prev = newNode;
+// removes the last element of the list
+template <class T, class A>
+void List<T, A>::pop_back() {
+    if (empty()) {
+        throw std::logic_error("empty list");
+    }
+    erase(make_iterator(sentinel.prev));
+}
+
+template <class T, class A>
+void List<T, A>::clear() {
+    if constexpr (std::is_trivially_destructible<Node>::value
+                  && detail::has_release<node_allocator>::value) {
+        // nothing to destroy: drop every slab at once if all nodes are ours
+        if (alloc.release(count)) {
+            reset_links();
+            return;
+        }
+    }
+    for (Links* node = sentinel.next; node != &sentinel;) {
+        free_node(std::exchange(node, node->next));
+    }
+    reset_links();
+}
+
+// inserts copies of [first, last) before pos; if one throws, the list is
+// unchanged. Returns the first element inserted, or pos if none was.
+template <class T, class A>
+template <class InputIt>
+typename List<T, A>::iterator
+List<T, A>::insert(List<T, A>::const_iterator pos, InputIt first, InputIt last) {
+    if (first == last) {
+        return make_iterator(pos.current);
+    }
+
+    // build the new nodes as a chain of their own, then link it in at once
+    Links* const front = make_node(*first);
+    Links* back = front;
+    size_type added = 1;
+
+    try {
+        for (++first; first != last; ++first, ++added) {
+            back->next = make_node(*first);
+            back->next->prev = back;
+            back = back->next;
+        }
+    } catch (...) {
+        while (back != nullptr) {
+            free_node(std::exchange(back, back->prev));
+        }
+        throw;
     }
+    link_nodes(pos.current, front, back);
+    count += added;
+    return make_iterator(front);
+}
+
+// inserts copies of the elements of ilist before pos
+template <class T, class A>
+typename List<T, A>::iterator
+List<T, A>::insert(List<T, A>::const_iterator pos, std::initializer_list<value_type> ilist) {
+    return insert(pos, ilist.begin(), ilist.end());
+}
+
+// inserts a new node before pos, its element constructed from args
+template <class T, class A>
+template <class... Args>
+typename List<T, A>::iterator List<T, A>::emplace(List<T, A>::const_iterator pos, Args&&... args) {
+    Links* const newNode = make_node(std::forward<Args>(args)...); // new node to be inserted
+
+    link_nodes(pos.current, newNode, newNode);
     ++count;
-    return iterator(newNode);
+    return make_iterator(newNode);
 }
 
 // function to erase a specific node from the list
-template <class T>
-typename List<T>::iterator List<T>::erase(List<T>::iterator pos) {
-    auto following = List<T>::iterator(); // iterator following pos
-
-    if (!empty() && pos != end()) {
-        if (pos == begin()) { // item to be deleted is first node
-            head = head->next;
-            
-            if(head != nullptr) {
-                head->prev = nullptr;
-            } else {
-                tail = nullptr;
-            } 
-        } else { // item to be deleted is somewhere else in list
-            pos->prev->next = pos->next;
+template <class T, class A>
+typename List<T, A>::iterator List<T, A>::erase(List<T, A>::const_iterator pos) {
+    Links* const node = pos.current;
 
-            if (pos->next != nullptr) {
-                pos->next->prev = pos->prev;
-            }
+    if constexpr (checked_iterators) {
+        pos.check(node);
+    }
+
+    Links* const following = node->next; // node following pos
+
+    unlink_nodes(node, node);
+    free_node(node);
+    --count;
+    return make_iterator(following);
+}
+
+template <class T, class A>
+void List<T, A>::swap(List<T, A>& other) {
+    if (this == &other) {
+        return;
+    }
+
+    // the nodes point at their sentinel, so the rings are re-anchored
+    // rather than the sentinels swapped
+    const Links ours = sentinel;
+    const size_type our_count = count;
+
+    reset_links();
+    take_links(other);
+    if (our_count != 0) {
+        link_nodes(&other.sentinel, ours.next, ours.prev);
+        other.count = our_count;
+    }
+    if constexpr (node_traits::propagate_on_container_swap::value) {
+        std::swap(alloc, other.alloc);
+    }
+}
+
+// moves every node of other in before pos
+template <class T, class A>
+void List<T, A>::splice(const_iterator pos, List<T, A>& other) {
+    if (this != &other && !other.empty()) {
+        check_splice(other);
+        link_nodes(pos.current, other.sentinel.next, other.sentinel.prev);
+        count += other.count;
+        other.reset_links();
+    }
+}
+
+// moves the node at it, from other, in before pos
+template <class T, class A>
+void List<T, A>::splice(const_iterator pos, List<T, A>& other, const_iterator it) {
+    Links* const node = it.current;
+
+    if (node == pos.current || node->next == pos.current) {
+        return;  // already in place
+    }
+    check_splice(other);
+    unlink_nodes(node, node);
+    link_nodes(pos.current, node, node);
+    --other.count;
+    ++count;
+}
+
+// moves the nodes [first, last), from other, in before pos; pos must not be
+// one of them. O(1) within a list; between lists the nodes are counted.
+template <class T, class A>
+void List<T, A>::splice(const_iterator pos, List<T, A>& other,
+                        const_iterator first, const_iterator last) {
+    if (first == last) {
+        return;
+    }
+    check_splice(other);
+
+    Links* const front = first.current;
+    Links* const back = last.current->prev;
+
+    if (this != &other) {
+        const size_type moved = std::distance(first, last);
+
+        other.count -= moved;
+        count += moved;
+    }
+    unlink_nodes(front, back);
+    link_nodes(pos.current, front, back);
+}
+
+// merges the sorted list other into this sorted list
+template <class T, class A>
+void List<T, A>::merge(List<T, A>& other) {
+    merge(other, std::less<>());
+}
+
+// merges the sorted list other into this sorted list; on ties, elements of
+// this list come first
+template <class T, class A>
+template <class Compare>
+void List<T, A>::merge(List<T, A>& other, Compare comp) {
+    if (this == &other || other.empty()) {
+        return;
+    }
+    if (empty()) {
+        splice(end(), other);
+        return;
+    }
+    check_splice(other);
+
+    // merge the two rings as nullptr-terminated chains, then close the result
+    sentinel.prev->next = nullptr;
+    other.sentinel.prev->next = nullptr;
+    sentinel.next = merge_chains(sentinel.next, other.sentinel.next, comp);
+    count += other.count;
+    other.reset_links();
+    relink_backward();
+}
+
+// sorts the list in ascending order
+template <class T, class A>
+void List<T, A>::sort() {
+    sort(std::less<>());
+}
+
+// sorts the list by comp with a bottom-up merge sort; equal elements keep
+// their order
+template <class T, class A>
+template <class Compare>
+void List<T, A>::sort(Compare comp) {
+    if (count < 2) {
+        return;
+    }
+
+    // runs[level] is nullptr or a sorted chain of 2^level nodes, made of
+    // nodes that came before those of every lower level
+    Links* runs[64] = {};
+    Links* next = sentinel.next;
 
-            if (pos == tail) {
-                tail = pos->prev;
+    sentinel.prev->next = nullptr;
+    while (next != nullptr) {
+        Links* carry = std::exchange(next, next->next);
+        std::size_t level = 0;
+
+        carry->next = nullptr;
+        for (; runs[level] != nullptr; ++level) {
+            carry = merge_chains(runs[level], carry, comp);
+            runs[level] = nullptr;
+        }
+        runs[level] = carry;
+    }
+
+    Links* sorted = nullptr;
+
+    for (Links* run : runs) {
+        if (run != nullptr) {
+            sorted = merge_chains(run, sorted, comp);
+        }
+    }
+    sentinel.next = sorted;
+    relink_backward();
+}
+
+// removes all but the first of each run of equal elements
+// returns the number of elements removed
+template <class T, class A>
+typename List<T, A>::size_type List<T, A>::unique() {
+    return unique(std::equal_to<>());
+}
+
+// removes every element for which pred(previous kept element, element) holds
+// returns the number of elements removed
+template <class T, class A>
+template <class BinaryPredicate>
+typename List<T, A>::size_type List<T, A>::unique(BinaryPredicate pred) {
+    const size_type before = count;
+
+    if (!empty()) {
+        for (Links* kept = sentinel.next; kept->next != &sentinel;) {
+            if (pred(value_of(kept), value_of(kept->next))) {
+                erase(make_iterator(kept->next));
+            } else {
+                kept = kept->next;
             }
         }
     }
-    following = pos->next;
-    delete pos.operator->();
-    --count;
-    return following;
+    return before - count;
 }
 
-template <class T>
-void List<T>::swap(List<T>& other) {
-    std::swap(head, other.head);
-    std::swap(tail, other.tail);
-    std::swap(count, other.count);
+// allocates a node whose element is constructed from args
+template <class T, class A>
+template <class... Args>
+typename List<T, A>::Node* List<T, A>::make_node(Args&&... args) {
+    Node* const node = node_traits::allocate(alloc, 1);
+
+    try {
+        node_traits::construct(alloc, node, std::forward<Args>(args)...);
+    } catch (...) {
+        node_traits::deallocate(alloc, node, 1);
+        throw;
+    }
+    return node;
 }
 
-template <class T>
-bool operator==(const List<T>& lhs, const List<T>& rhs) {
+// destroys node and returns it to the allocator
+template <class T, class A>
+void List<T, A>::free_node(Links* links) {
+    Node* const node = static_cast<Node*>(links);
+
+    node_traits::destroy(alloc, node);
+    node_traits::deallocate(alloc, node, 1);
+}
+
+// throws unless other's nodes may become ours
+template <class T, class A>
+void List<T, A>::check_splice(const List<T, A>& other) const {
+    if (this != &other && alloc != other.alloc) {
+        throw std::invalid_argument("splice between lists with unequal allocators");
+    }
+}
+
+// unlinks the nodes [first, last] from the list; their own links are kept
+template <class T, class A>
+void List<T, A>::unlink_nodes(Links* first, Links* last) {
+    first->prev->next = last->next;
+    last->next->prev = first->prev;
+}
+
+// links the chain of nodes [first, last] in before pos
+template <class T, class A>
+void List<T, A>::link_nodes(Links* pos, Links* first, Links* last) {
+    Links* const prev = pos->prev;
+
+    first->prev = prev;
+    last->next = pos;
+    prev->next = first;
+    pos->prev = last;
+}
+
+// empties the ring, leaving the sentinel linked to itself
+template <class T, class A>
+void List<T, A>::reset_links() {
+    sentinel.prev = sentinel.next = &sentinel;
+    count = 0;
+}
+
+// takes over the nodes of other, which is left empty
+template <class T, class A>
+void List<T, A>::take_links(List<T, A>& other) {
+    if (!other.empty()) {
+        link_nodes(&sentinel, other.sentinel.next, other.sentinel.prev);
+        count = other.count;
+        other.reset_links();
+    }
+}
+
+// closes the chain starting at sentinel.next into a ring
+template <class T, class A>
+void List<T, A>::relink_backward() {
+    Links* prev = &sentinel;
+
+    for (Links* node = sentinel.next; node != nullptr; node = node->next) {
+        node->prev = prev;
+        prev = node;
+    }
+    prev->next = &sentinel;
+    sentinel.prev = prev;
+}
+
+// merges two sorted chains linked through next, taking from first on ties
+template <class T, class A>
+template <class Compare>
+typename List<T, A>::Links* List<T, A>::merge_chains(Links* first, Links* second, Compare& comp) {
+    Links* merged = nullptr;
+    Links** link = &merged;  // where the next node taken goes
+
+    while (first != nullptr && second != nullptr) {
+        if (comp(value_of(second), value_of(first))) {
+            *link = std::exchange(second, second->next);
+        } else {
+            *link = std::exchange(first, first->next);
+        }
+        link = &(*link)->next;
+    }
+    *link = first != nullptr ? first : second;
+    return merged;
+}
+
+template <class T, class A>
+bool operator==(const List<T, A>& lhs, const List<T, A>& rhs) {
     return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
-template <class T>
-bool operator!=(const List<T>& lhs, const List<T>& rhs) {
+template <class T, class A>
+bool operator!=(const List<T, A>& lhs, const List<T, A>& rhs) {
     return !(lhs == rhs);
 }
 
-template <class T>
-std::ostream& operator<<(std::ostream& output, const List<T>& list) {
-    char separator[2]{};
-
+template <class T, class A>
+std::ostream& operator<<(std::ostream& output, const List<T, A>& list) {
     output << '{';
 
-    for (auto& itr : list) {
-        output << separator << itr;
-        *separator = ',';
+    BufferedWriter writer(output);
+
+    for (auto itr = list.begin(); itr != list.end(); ++itr) {
+        if (itr != list.begin()) {
+            writer.put(',');
+        }
+        writer.write(*itr);
     }
-    return output << '}';
+    writer.put('}');
+
+    return output;
+}
+
+namespace detail {
+
+// writes list to sink: the header, then every item
+template <class Sink, class T, class A>
+void save_list(Sink& sink, const List<T, A>& list) {
+    serial::write_header<T>(sink, "LIST", list.size());
+    serial::write_items(sink, list.begin(), list.end());
+}
+
+// reads a List from source
+template <class Source, class T, class A>
+List<T, A> load_list(Source& source, const A& alloc) {
+    const auto count = serial::read_header<T>(source, "LIST");
+    List<T, A> list(alloc);
+
+    // nodes are not contiguous, so items are read a chunk at a time and a
+    // node is made for each once its bytes have arrived
+    serial::read_items<T>(source, count, std::back_inserter(list));
+    return list;
+}
+
+}  // namespace detail
+
+template <class T, class A>
+void save(std::ostream& output, const List<T, A>& list) {
+    serial::StreamSink sink(output);
+    detail::save_list(sink, list);
+}
+
+template <class T, class A>
+void save(std::vector<char>& buffer, const List<T, A>& list) {
+    serial::BufferSink sink(buffer);
+    detail::save_list(sink, list);
+}
+
+template <class T, class A>
+void load(std::istream& input, List<T, A>& list) {
+    serial::StreamSource source(input);
+    list = detail::load_list<serial::StreamSource, T>(source, list.get_allocator());
+}
+
+template <class T, class A>
+const char* load(const char* first, const char* last, List<T, A>& list) {
+    serial::BufferSource source(first, last);
+    list = detail::load_list<serial::BufferSource, T>(source, list.get_allocator());
+    return source.position();
 }
 
 #endif
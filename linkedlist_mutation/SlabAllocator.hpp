@@ -0,0 +1,260 @@
+/// @file SlabAllocator.hpp
+/// @author Brandon Timok
+/// @date 04/12/2022
+/// @brief A SlabAllocator hands out List nodes from large contiguous slabs
+/// and recycles freed nodes through a free list, so building a list costs one
+/// heap allocation per slab instead of one per node.
+
+#ifndef SLAB_ALLOCATOR_HPP
+#define SLAB_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "List.hpp"
+
+/// A pool of equally sized blocks carved out of slabs of slab_items blocks.
+///
+/// The block size is fixed by the first request; requests of any other size
+/// or alignment, and arrays, go to operator new as usual. Freed blocks are
+/// kept on a free list and handed out again before a slab is touched. Slabs
+/// are only returned to the heap by release() or by the destructor.
+class SlabPool {
+public:
+    using size_type = std::size_t;
+
+    /// Blocks per slab when none is given.
+    static constexpr size_type default_slab_items = 256;
+
+    explicit SlabPool(size_type slab_items = default_slab_items)
+    : slab_items(std::max<size_type>(slab_items, 1)) {}
+
+    SlabPool(const SlabPool&) = delete;
+    SlabPool& operator=(const SlabPool&) = delete;
+
+    /// Frees every slab. Blocks still handed out become invalid.
+    ~SlabPool() { free_slabs(); }
+
+    /// Returns uninitialized storage of size bytes aligned to align.
+    /// @throws std::bad_alloc if no memory is available.
+    void* allocate(size_type size, size_type align);
+
+    /// Takes back storage returned by allocate(size, align).
+    void deallocate(void* ptr, size_type size, size_type align) noexcept;
+
+    /// Frees every slab at once, without visiting the blocks, provided the
+    /// caller's blocks of size bytes aligned to align are pooled and live is
+    /// the number of blocks still handed out: i.e. the caller owns all of
+    /// them and is done with them. Their contents are not destroyed.
+    /// @returns true if the slabs were freed, false if other blocks are out
+    /// or the caller's blocks never came from the slabs.
+    bool release(size_type live, size_type size, size_type align) noexcept;
+
+    /// Returns the number of blocks handed out and not yet taken back.
+    size_type live() const { return used; }
+
+    /// Returns the number of slabs held.
+    size_type slab_count() const { return slabs; }
+
+private:
+    /// Header in front of the blocks of each slab; keeps them max-aligned.
+    struct alignas(std::max_align_t) Slab {
+        Slab* next;
+    };
+
+    /// A free block, linked through its own storage.
+    struct Block {
+        Block* next;
+    };
+
+    /// Checks whether a request is served from the slabs.
+    bool pooled(size_type size, size_type align) const {
+        return size == item_size && align == item_align;
+    }
+
+    /// Adds a slab and makes its blocks the next to be handed out.
+    void grow();
+
+    /// Returns every slab to the heap.
+    void free_slabs() noexcept;
+
+    size_type      slab_items;          ///< Blocks per slab.
+    size_type      item_size  = 0;      ///< Size of the requests pooled, 0 until the first.
+    size_type      item_align = 0;      ///< Alignment of the requests pooled.
+    size_type      block_size = 0;      ///< Stride between blocks in a slab.
+    Slab*          first      = nullptr; ///< Newest slab; each links to the older.
+    size_type      slabs      = 0;      ///< Number of slabs held.
+    unsigned char* cursor     = nullptr; ///< Next never-used block of the newest slab.
+    size_type      remaining  = 0;      ///< Never-used blocks left at cursor.
+    Block*         recycled   = nullptr; ///< Blocks taken back, most recent first.
+    size_type      used       = 0;      ///< Blocks handed out.
+};
+
+/// An allocator that takes single objects from a SlabPool.
+///
+/// A default-constructed SlabAllocator owns a pool of its own, and so does
+/// the copy of a List made with one: each list keeps its nodes together.
+/// To let several lists share a pool, construct them from one allocator or
+/// from the same std::shared_ptr<SlabPool>.
+///
+/// When T is trivially destructible, List::clear() and the destructor hand
+/// the whole pool back through release() instead of freeing node by node.
+template <class T>
+class SlabAllocator {
+public:
+    /// Member types.
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    // copies of a list start a pool of their own; moves and swaps take it along
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+
+    /// Allocates from a new pool of its own.
+    SlabAllocator() : source(std::make_shared<SlabPool>()) {}
+
+    /// Allocates from pool, which may be shared.
+    explicit SlabAllocator(std::shared_ptr<SlabPool> pool) : source(std::move(pool)) {}
+
+    // no move: a List moved from must still have a pool to allocate from
+    SlabAllocator(const SlabAllocator& other) = default;
+    SlabAllocator& operator=(const SlabAllocator& rhs) = default;
+
+    template <class U>
+    SlabAllocator(const SlabAllocator<U>& other) noexcept : source(other.source) {}
+
+    /// Returns uninitialized storage for count elements.
+    /// @throws std::bad_alloc if no memory is available.
+    T* allocate(size_type count) {
+        return static_cast<T*>(source->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    /// Releases storage returned for count elements.
+    void deallocate(T* ptr, size_type count) noexcept {
+        source->deallocate(ptr, count * sizeof(T), alignof(T));
+    }
+
+    /// Frees the whole pool at once if live is the number of blocks out and
+    /// they are all blocks for a T.
+    /// @returns true if it did.
+    bool release(size_type live) noexcept {
+        return source->release(live, sizeof(T), alignof(T));
+    }
+
+    /// A copy of a list gets a pool of its own.
+    SlabAllocator select_on_container_copy_construction() const { return SlabAllocator(); }
+
+    /// Returns the pool allocated from.
+    const std::shared_ptr<SlabPool>& pool() const { return source; }
+
+    template <class U>
+    friend bool operator==(const SlabAllocator& lhs, const SlabAllocator<U>& rhs) {
+        return lhs.source == rhs.pool();
+    }
+
+    template <class U>
+    friend bool operator!=(const SlabAllocator& lhs, const SlabAllocator<U>& rhs) {
+        return lhs.source != rhs.pool();
+    }
+
+private:
+    template <class U>
+    friend class SlabAllocator;
+
+    std::shared_ptr<SlabPool> source; ///< Pool the blocks come from.
+};
+
+/// A List whose nodes come from slabs.
+template <class T>
+using SlabList = List<T, SlabAllocator<T>>;
+
+// ============================================================================
+
+/// Returns uninitialized storage of size bytes aligned to align.
+inline void* SlabPool::allocate(size_type size, size_type align) {
+    if (item_size == 0 && align <= alignof(std::max_align_t)) {
+        // the first request sets the block size; the free list needs room
+        // for a pointer in each block, and every block stays aligned
+        const size_type stride = std::max(align, alignof(Block));
+
+        item_size = size;
+        item_align = align;
+        block_size = (std::max(size, sizeof(Block)) + stride - 1) / stride * stride;
+    }
+    if (!pooled(size, align)) {
+        return ::operator new(size, std::align_val_t(align));
+    }
+
+    void* block = nullptr;
+
+    if (recycled != nullptr) {
+        block = recycled;
+        recycled = recycled->next;
+    } else {
+        if (remaining == 0) {
+            grow();
+        }
+        block = cursor;
+        cursor += block_size;
+        --remaining;
+    }
+    ++used;
+    return block;
+}
+
+/// Takes back storage returned by allocate(size, align).
+inline void SlabPool::deallocate(void* ptr, size_type size, size_type align) noexcept {
+    if (!pooled(size, align)) {
+        ::operator delete(ptr, std::align_val_t(align));
+        return;
+    }
+    recycled = ::new (ptr) Block{recycled};
+    --used;
+}
+
+/// Frees every slab at once if the caller's blocks are pooled and live is
+/// the number of blocks handed out.
+/// @returns true if the slabs were freed.
+inline bool SlabPool::release(size_type live, size_type size, size_type align) noexcept {
+    // blocks of another size went to operator new and are not counted in
+    // used, so their owner cannot vouch for the slabs
+    if (!pooled(size, align) || live != used) {
+        return false;
+    }
+    free_slabs();
+    cursor = nullptr;
+    remaining = 0;
+    recycled = nullptr;
+    used = 0;
+    return true;
+}
+
+/// Adds a slab and makes its blocks the next to be handed out.
+inline void SlabPool::grow() {
+    void* const storage = ::operator new(sizeof(Slab) + slab_items * block_size);
+
+    first = ::new (storage) Slab{first};
+    ++slabs;
+    cursor = reinterpret_cast<unsigned char*>(first + 1);
+    remaining = slab_items;
+}
+
+/// Returns every slab to the heap.
+inline void SlabPool::free_slabs() noexcept {
+    while (first != nullptr) {
+        Slab* const next = first->next;
+
+        ::operator delete(first);
+        first = next;
+    }
+    slabs = 0;
+}
+
+#endif /* SLAB_ALLOCATOR_HPP */
+
+/* EOF */
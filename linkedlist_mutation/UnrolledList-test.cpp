@@ -0,0 +1,257 @@
+/// @file UnrolledList-test.cpp
+/// @date 2022-04-16
+/// @brief Catch2 Unit tests for the UnrolledList class
+
+#define CATCH_CONFIG_MAIN
+#if defined __linux__
+#include <catch.hpp>
+#elif defined __MACH__
+#include </opt/local/include/catch2/catch.hpp>
+#else
+#include "catch.hpp"
+#endif
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <list>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#include "UnrolledList.hpp"
+#include "UnrolledList.hpp"  // check include guard
+
+TEMPLATE_TEST_CASE("UnrolledList()", "", char, int, double) {
+    UnrolledList<TestType> list1{};
+
+    REQUIRE(list1.size() == 0);
+    REQUIRE(list1.empty() == true);
+    REQUIRE(list1.begin() == list1.end());
+    REQUIRE(list1.node_count() == 0);
+    CHECK_THROWS(list1.front());
+    CHECK_THROWS(list1.back());
+}
+
+TEMPLATE_TEST_CASE("UnrolledList copy and move", "", char, int, double) {
+    const UnrolledList<TestType, 4> REF { 65, 66, 67, 68, 69, 70, 71, 72, 73 };
+
+    UnrolledList<TestType, 4> list1(REF);
+    CHECK(list1 == REF);
+    CHECK(list1.begin() != REF.begin());
+
+    UnrolledList<TestType, 4> list2(std::move(list1));
+    CHECK(list2 == REF);
+    CHECK(list1.empty() == true);
+
+    list1 = REF;
+    CHECK(list1 == REF);
+    list1 = list1;
+    CHECK(list1 == REF);
+
+    list2.clear();
+    list2 = std::move(list1);
+    CHECK(list2 == REF);
+    CHECK(list1.empty() == true);
+
+    list1.swap(list2);
+    CHECK(list1 == REF);
+    CHECK(list2.empty() == true);
+}
+
+TEMPLATE_TEST_CASE("UnrolledList packs K elements per node", "", char, int, double) {
+    UnrolledList<TestType, 4> list1{};
+
+    for (int i = 0; i < 1000; ++i) {
+        list1.insert(list1.end(), TestType(65 + i % 26));
+    }
+    CHECK(list1.size() == 1000);
+    CHECK(list1.node_count() == 250);
+    CHECK(std::distance(list1.begin(), list1.end()) == 1000);
+
+    // the default K fills about 256 bytes
+    CHECK(UnrolledList<TestType>::node_capacity == 256 / sizeof(TestType));
+}
+
+TEMPLATE_TEST_CASE("UnrolledList iterators cross nodes both ways", "", char, int, double) {
+    const UnrolledList<TestType, 3> list1 { 65, 66, 67, 68, 69, 70, 71 };
+    const std::initializer_list<TestType> REF { 65, 66, 67, 68, 69, 70, 71 };
+
+    CHECK(std::equal(list1.begin(), list1.end(), REF.begin(), REF.end()) == true);
+
+    auto itr = list1.end();
+    for (auto ref = std::rbegin(REF); ref != std::rend(REF); ++ref) {
+        --itr;
+        CHECK(*itr == *ref);
+    }
+    CHECK(itr == list1.begin());
+
+    CHECK(*--list1.end() == 71);
+    CHECK(*list1.begin()++ == 65);
+}
+
+TEMPLATE_TEST_CASE("UnrolledList const_iterator", "", char, int, double) {
+    UnrolledList<TestType, 3> list1 { 65, 66, 67, 68, 69 };
+    const auto& REF = list1;
+
+    static_assert(std::is_same<decltype(REF.begin()),
+                               typename UnrolledList<TestType, 3>::const_iterator>::value,
+                  "begin() const returns a const_iterator");
+    static_assert(std::is_same<decltype(*list1.cbegin()), const TestType&>::value,
+                  "a const_iterator yields const references");
+
+    typename UnrolledList<TestType, 3>::const_iterator itr = list1.begin();
+    CHECK(itr == list1.cbegin());
+    CHECK(std::distance(list1.cbegin(), list1.cend()) == 5);
+    CHECK(*std::next(REF.begin(), 3) == 68);
+
+    // insert() and erase() take const_iterators
+    CHECK(*list1.insert(list1.cend(), TestType(70)) == 70);
+    CHECK(*list1.erase(list1.cbegin()) == 66);
+}
+
+TEST_CASE("UnrolledList positions at a node boundary compare equal") {
+    UnrolledList<int, 4> list1 { 1, 2, 3, 4 };
+
+    // end() of a full tail names the slot past its last element; appending
+    // starts a new node, so that slot now names the new element
+    auto pos = list1.end();
+    auto itr = list1.insert(pos, 5);
+
+    REQUIRE(list1.node_count() == 2);
+    CHECK(pos == itr);
+    CHECK(*pos == 5);
+    CHECK(++pos == list1.end());
+
+    // a split leaves each half reachable from either side of the boundary
+    itr = list1.insert(std::next(list1.begin()), 10);
+    REQUIRE(list1.node_count() == 3);
+    CHECK(std::next(itr) == std::prev(std::next(itr, 2)));
+    CHECK(*std::next(itr) == 2);
+
+    // a merge moves elements into an earlier node; walking and erase agree
+    itr = list1.erase(list1.begin());
+    itr = list1.erase(itr);
+    CHECK(itr == list1.begin());
+    CHECK(*itr == 2);
+    CHECK(std::next(list1.begin(), 2) == list1.erase(std::next(list1.begin(), 2)));
+    CHECK(std::equal(list1.begin(), list1.end(), std::begin({ 2, 3, 5 })));
+}
+
+TEST_CASE("UnrolledList insert()") {
+    UnrolledList<int, 4> list1{};
+
+    // insert into an empty list
+    auto itr = list1.insert(list1.begin(), 66);
+    CHECK(*itr == 66);
+
+    // insert into front and back of a list
+    CHECK(*list1.insert(list1.begin(), 65) == 65);
+    CHECK(*list1.insert(list1.end(), 68) == 68);
+
+    // insert into middle of a list
+    CHECK(*list1.insert(std::next(list1.begin(), 2), 67) == 67);
+    CHECK(list1.node_count() == 1);
+
+    // insert into the middle of a full node splits it
+    itr = list1.insert(std::next(list1.begin(), 1), 100);
+    CHECK(*itr == 100);
+    CHECK(*++itr == 66);
+    CHECK(list1.node_count() == 2);
+    CHECK(list1 == UnrolledList<int, 4>{ 65, 100, 66, 67, 68 });
+
+    // an element of the list can be inserted into its own node
+    list1.insert(std::next(list1.begin(), 1), list1.back());
+    CHECK(list1 == UnrolledList<int, 4>{ 65, 68, 100, 66, 67, 68 });
+    CHECK(list1.size() == 6);
+}
+
+TEST_CASE("UnrolledList erase()") {
+    UnrolledList<int, 4> list1 { 65, 66, 67, 68, 69, 70, 71, 72 };
+    REQUIRE(list1.node_count() == 2);
+
+    // delete last element
+    auto itr = list1.erase(std::prev(list1.end()));
+    CHECK(itr == list1.end());
+    CHECK(list1.back() == 71);
+
+    // delete middle element
+    itr = list1.erase(std::next(list1.begin(), 2));
+    CHECK(*itr == 68);
+    CHECK(list1 == UnrolledList<int, 4>{ 65, 66, 68, 69, 70, 71 });
+
+    // delete front element
+    itr = list1.erase(list1.begin());
+    CHECK(*itr == 66);
+    CHECK(list1 == UnrolledList<int, 4>{ 66, 68, 69, 70, 71 });
+
+    // erasing end() does nothing
+    CHECK(list1.erase(list1.end()) == list1.end());
+
+    // delete every element, leaving an empty container
+    while (!list1.empty()) {
+        list1.erase(list1.begin());
+    }
+    CHECK(list1.size() == 0);
+    CHECK(list1.node_count() == 0);
+    CHECK(list1.begin() == list1.end());
+}
+
+TEMPLATE_TEST_CASE("UnrolledList matches std::list under random edits", "", char, int, double) {
+    UnrolledList<TestType, 5> list1{};
+    std::list<TestType> ref{};
+    std::mt19937 random(42);
+
+    for (int step = 0; step < 5000; ++step) {
+        const std::size_t where = ref.empty() ? 0 : random() % (ref.size() + 1);
+
+        if (random() % 3 != 0 || where == ref.size()) {
+            const TestType value = TestType(random() % 100);
+            auto itr = list1.insert(std::next(list1.begin(), where), value);
+            ref.insert(std::next(ref.begin(), where), value);
+            REQUIRE(*itr == value);
+        } else {
+            auto itr = list1.erase(std::next(list1.begin(), where));
+            auto next = ref.erase(std::next(ref.begin(), where));
+            REQUIRE((itr == list1.end()) == (next == ref.end()));
+            if (next != ref.end()) {
+                REQUIRE(*itr == *next);
+            }
+        }
+        REQUIRE(list1.size() == ref.size());
+    }
+    CHECK(std::equal(list1.begin(), list1.end(), ref.begin(), ref.end()) == true);
+    CHECK(list1.node_count() * 5 >= list1.size());
+}
+
+TEST_CASE("UnrolledList<std::string>") {
+    const UnrolledList<std::string, 3> REF {
+        "Alpha", "Bravo", "Charlie", "Delta", "Echo", "Foxtrot", "Golf"
+    };
+
+    UnrolledList<std::string, 3> list1 { REF };
+    list1.insert(std::next(list1.begin(), 1), std::string(1000, 'B'));
+    list1.erase(std::next(list1.begin(), 4));
+    CHECK(list1.size() == 7);
+    CHECK(list1.front() == "Alpha");
+    CHECK(*std::next(list1.begin()) == std::string(1000, 'B'));
+    CHECK(list1 != REF);
+
+    std::ostringstream output{};
+    output << REF;
+    CHECK(output.str() == "{Alpha,Bravo,Charlie,Delta,Echo,Foxtrot,Golf}");
+}
+
+TEST_CASE("std::ostream& operator<<(std::ostream&, const UnrolledList<int>&)") {
+    std::ostringstream output{};
+
+    output << UnrolledList<int, 2>{};
+    CHECK(output.str() == "{}");
+
+    output.str("");
+    output << UnrolledList<int, 2>{ 65, 66, 67, 68, 69 };
+    CHECK(output.str() == "{65,66,67,68,69}");
+}
+
+/* EOF */
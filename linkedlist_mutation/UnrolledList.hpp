@@ -0,0 +1,506 @@
+/// @file UnrolledList.hpp
+/// @author Brandon Timok
+/// @date 04/12/2022
+/// @brief Header file for an unrolled list: a doubly linked list whose nodes
+/// each hold up to K elements side by side.
+
+#ifndef UNROLLED_LIST_HPP
+#define UNROLLED_LIST_HPP
+
+#include <iostream>
+#include <algorithm>
+#include <utility>
+#include <initializer_list>
+#include <iterator>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../common/BufferedWriter.hpp"
+
+// Each node stores up to K elements in a small array, so a scan touches one
+// node per K elements instead of one per element, and the two links are
+// shared by K elements. The default K fills about 256 bytes per node.
+//
+// insert() and erase() keep the List semantics: insert goes before pos and
+// returns the new element, erase returns the element that followed. Both
+// shift elements within one node only, and may split a full node or merge a
+// sparse one into its successor, so they invalidate iterators to the node(s)
+// touched. Iterators to other nodes stay valid.
+//
+// A position is a node and an index into it. The slot just past the last
+// element of a node other than the tail is the first element of the next
+// node, so iterators settle there before they are used or compared.
+template <class T, std::size_t K = std::max<std::size_t>(2, 256 / sizeof(T))>
+class UnrolledList {
+    static_assert(K >= 2, "UnrolledList needs room for two elements per node");
+
+private:
+    struct Node {
+        Node*       prev{};  ///< pointer to the previous Node
+        Node*       next{};  ///< pointer to the next Node
+        std::size_t used{};  ///< number of elements in items()
+
+        alignas(T) unsigned char storage[K * sizeof(T)];  ///< room for K elements
+
+        // elements [0, used) are alive, the rest is raw storage
+        T* items() { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+public:
+    template <bool Const>
+    class Iterator {
+    public:
+        // member types
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<Const, const value_type*, value_type*>;
+        using reference         = std::conditional_t<Const, const value_type&, value_type&>;
+
+        Iterator() = default;
+
+        // an iterator converts to a const_iterator
+        template <bool C = Const, class = std::enable_if_t<C>>
+        Iterator(const Iterator<false>& other)
+        : node(other.node), index(other.index)
+        {}
+
+        reference operator*() const {
+            const Iterator at = settled();
+
+            if (at.node == nullptr) {
+                throw std::logic_error("error: dereferencing nullptr");
+            }
+            return at.node->items()[at.index];
+        }
+
+        pointer operator->() const {
+            return &**this;
+        }
+
+        Iterator& operator++() {
+            if (node == nullptr) {
+                throw std::logic_error("error: dereferencing nullptr");
+            }
+            *this = settled();
+            ++index;
+            *this = settled();
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        Iterator& operator--() {
+            if (node == nullptr) {
+                throw std::logic_error("error: dereferencing nullptr");
+            }
+            if (index == 0) {
+                node = node->prev;
+                index = node != nullptr ? node->used : 1;
+            }
+            --index;
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            Iterator tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs) {
+            const Iterator left = lhs.settled();
+            const Iterator right = rhs.settled();
+
+            return left.node == right.node && left.index == right.index;
+        }
+
+        friend bool operator!=(const Iterator& lhs, const Iterator& rhs) {
+            return !(lhs == rhs);
+        }
+
+    private:
+        friend class UnrolledList;
+        friend class Iterator<!Const>;
+
+        explicit Iterator(Node* node, std::size_t index = 0)
+        : node(node), index(index)
+        {
+            *this = settled();
+        }
+
+        // the same position with the slot past a non-tail node's last
+        // element moved to the start of the next node
+        Iterator settled() const {
+            Iterator at = *this;
+
+            if (at.node != nullptr && at.index == at.node->used && at.node->next != nullptr) {
+                at.node = at.node->next;
+                at.index = 0;
+            }
+            return at;
+        }
+
+        Node*       node{};   ///< node holding the element
+        std::size_t index{};  ///< position of the element in the node
+    };
+
+    // Member types
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using iterator        = Iterator<false>;
+    using const_iterator  = Iterator<true>;
+
+    // most elements a node holds
+    static constexpr size_type node_capacity = K;
+
+    UnrolledList() = default;
+    UnrolledList(const UnrolledList& other);
+    UnrolledList(UnrolledList&& other);
+    UnrolledList(const std::initializer_list<value_type>& ilist);
+    virtual ~UnrolledList();
+    UnrolledList& operator=(const UnrolledList& rhs);
+    UnrolledList& operator=(UnrolledList&& rhs);
+    reference front();
+    reference back();
+    iterator begin() { return iterator(head); }
+    const_iterator begin() const { return const_iterator(head); }
+    const_iterator cbegin() const { return begin(); }
+    iterator end() { return tail != nullptr ? iterator(tail, tail->used) : iterator(); }
+    const_iterator end() const { return tail != nullptr ? const_iterator(tail, tail->used) : const_iterator(); }
+    const_iterator cend() const { return end(); }
+    bool empty() const { return count == 0; }
+    size_type size() const { return count; }
+    size_type node_count() const;
+    void clear();
+    iterator insert(const_iterator pos, const value_type& value);
+    iterator erase(const_iterator pos);
+    void swap(UnrolledList& other);
+
+protected:
+    Node*     head{};   ///< pointer to the head node
+    Node*     tail{};   ///< pointer to the tail node
+    size_type count{};  ///< number of elements in list
+
+private:
+    // links a new, empty node after prev, or at the front if prev is nullptr
+    Node* link_node(Node* prev);
+
+    // unlinks node and frees it; its elements must already be destroyed
+    void unlink_node(Node* node);
+
+    // moves the upper half of a full node into a new node after it
+    void split(Node* node);
+
+    // moves the elements of node->next to the end of node and frees it
+    void absorb(Node* node);
+
+    // constructs a copy of value at index in node, shifting later ones up
+    void place(Node* node, size_type index, const value_type& value);
+};
+
+/** NON-MEMBER TEMPLATE FUNCTIONS **/
+template <class T, std::size_t K>
+bool operator==(const UnrolledList<T, K>& lhs, const UnrolledList<T, K>& rhs);
+
+template <class T, std::size_t K>
+bool operator!=(const UnrolledList<T, K>& lhs, const UnrolledList<T, K>& rhs);
+
+template <class T, std::size_t K>
+std::ostream& operator<<(std::ostream& output, const UnrolledList<T, K>& list);
+
+// copy constructor
+template <class T, std::size_t K>
+UnrolledList<T, K>::UnrolledList(const UnrolledList<T, K>& other) {
+    for (auto& itr : other) {
+        insert(end(), itr);
+    }
+}
+
+// move constructor
+template <class T, std::size_t K>
+UnrolledList<T, K>::UnrolledList(UnrolledList<T, K>&& other) {
+    head = std::exchange(other.head, nullptr);
+    tail = std::exchange(other.tail, nullptr);
+    count = std::exchange(other.count, 0);
+}
+
+// list initializer
+template <class T, std::size_t K>
+UnrolledList<T, K>::UnrolledList(const std::initializer_list<value_type>& ilist) {
+    for (auto& itr : ilist) {
+        UnrolledList<T, K>::insert(end(), itr);
+    }
+}
+
+// destructor
+template <class T, std::size_t K>
+UnrolledList<T, K>::~UnrolledList() {
+    clear();
+}
+
+// copy assignment operator
+template <class T, std::size_t K>
+UnrolledList<T, K>& UnrolledList<T, K>::operator=(const UnrolledList<T, K>& rhs) {
+    if (this != &rhs) {
+        UnrolledList<T, K> copy(rhs);
+        swap(copy);
+    }
+    return *this;
+}
+
+// move assignment operator
+template <class T, std::size_t K>
+UnrolledList<T, K>& UnrolledList<T, K>::operator=(UnrolledList<T, K>&& rhs) {
+    if (this != &rhs) {
+        clear();
+        head = std::exchange(rhs.head, nullptr);
+        tail = std::exchange(rhs.tail, nullptr);
+        count = std::exchange(rhs.count, 0);
+    }
+    return *this;
+}
+
+// returns first element of the list
+template <class T, std::size_t K>
+typename UnrolledList<T, K>::reference UnrolledList<T, K>::front() {
+    return !empty() ? head->items()[0] : throw std::logic_error("empty list");
+}
+
+// returns the last element of the list
+template <class T, std::size_t K>
+typename UnrolledList<T, K>::reference UnrolledList<T, K>::back() {
+    return !empty() ? tail->items()[tail->used - 1] : throw std::logic_error("empty list");
+}
+
+// returns the number of nodes, e.g. to gauge memory use
+template <class T, std::size_t K>
+typename UnrolledList<T, K>::size_type UnrolledList<T, K>::node_count() const {
+    size_type nodes = 0;
+
+    for (Node* node = head; node != nullptr; node = node->next) {
+        ++nodes;
+    }
+    return nodes;
+}
+
+template <class T, std::size_t K>
+void UnrolledList<T, K>::clear() {
+    while (head != nullptr) {
+        std::destroy(head->items(), head->items() + head->used);
+        delete std::exchange(head, head->next);
+    }
+    tail = nullptr;
+    count = 0;
+}
+
+// inserts value before pos
+template <class T, std::size_t K>
+typename UnrolledList<T, K>::iterator
+UnrolledList<T, K>::insert(UnrolledList<T, K>::const_iterator pos, const value_type& value) {
+    pos = pos.settled();
+
+    Node* node = pos.node;       // node the value goes into
+    size_type index = pos.index; // position in that node
+
+    if (node == nullptr) { // if empty, start the first node
+        node = link_node(nullptr);
+        index = 0;
+    } else if (node->used == K) { // if the node is full, make room
+        if (index == 0 && node->prev != nullptr && node->prev->used < K) {
+            node = node->prev; // append to the previous node instead
+            index = node->used;
+        } else if (index == K) {
+            node = link_node(node); // appending: start a new node
+            index = 0;
+        } else {
+            split(node);
+            if (index > node->used) {
+                index -= node->used;
+                node = node->next;
+            }
+        }
+    }
+
+    try {
+        place(node, index, value);
+    } catch (...) {
+        if (node->used == 0) {
+            unlink_node(node);
+        }
+        throw;
+    }
+    ++count;
+    return iterator(node, index);
+}
+
+// erases the element at pos
+template <class T, std::size_t K>
+typename UnrolledList<T, K>::iterator
+UnrolledList<T, K>::erase(UnrolledList<T, K>::const_iterator pos) {
+    pos = pos.settled();
+
+    Node* const node = pos.node;
+    const size_type index = pos.index;
+
+    if (node == nullptr || index >= node->used) {
+        return end();
+    }
+
+    T* const items = node->items();
+
+    std::move(items + index + 1, items + node->used, items + index);
+    std::destroy_at(items + node->used - 1);
+    --node->used;
+    --count;
+
+    if (node->used == 0) { // the node is empty: drop it
+        Node* const next = node->next;
+
+        unlink_node(node);
+        return next != nullptr ? iterator(next) : end();
+    }
+
+    if constexpr (std::is_nothrow_move_constructible<T>::value) {
+        // keep nodes at least half full where a neighbour can take them
+        if (node->used < K / 2 && node->next != nullptr && node->used + node->next->used <= K) {
+            absorb(node);
+        }
+    }
+
+    if (index < node->used) {
+        return iterator(node, index);
+    }
+    return node->next != nullptr ? iterator(node->next) : end();
+}
+
+template <class T, std::size_t K>
+void UnrolledList<T, K>::swap(UnrolledList<T, K>& other) {
+    std::swap(head, other.head);
+    std::swap(tail, other.tail);
+    std::swap(count, other.count);
+}
+
+// links a new, empty node after prev, or at the front if prev is nullptr
+template <class T, std::size_t K>
+typename UnrolledList<T, K>::Node* UnrolledList<T, K>::link_node(Node* prev) {
+    Node* const node = new Node;
+
+    node->prev = prev;
+    node->next = prev != nullptr ? prev->next : head;
+
+    if (node->next != nullptr) {
+        node->next->prev = node;
+    } else {
+        tail = node;
+    }
+    if (prev != nullptr) {
+        prev->next = node;
+    } else {
+        head = node;
+    }
+    return node;
+}
+
+// unlinks node and frees it; its elements must already be destroyed
+template <class T, std::size_t K>
+void UnrolledList<T, K>::unlink_node(Node* node) {
+    if (node->prev != nullptr) {
+        node->prev->next = node->next;
+    } else {
+        head = node->next;
+    }
+    if (node->next != nullptr) {
+        node->next->prev = node->prev;
+    } else {
+        tail = node->prev;
+    }
+    delete node;
+}
+
+// moves the upper half of a full node into a new node after it
+template <class T, std::size_t K>
+void UnrolledList<T, K>::split(Node* node) {
+    constexpr size_type keep = K / 2;
+    Node* const next = link_node(node);
+    T* const items = node->items();
+
+    try {
+        std::uninitialized_move(items + keep, items + node->used, next->items());
+    } catch (...) {
+        unlink_node(next);
+        throw;
+    }
+    std::destroy(items + keep, items + node->used);
+    next->used = node->used - keep;
+    node->used = keep;
+}
+
+// moves the elements of node->next to the end of node and frees it
+template <class T, std::size_t K>
+void UnrolledList<T, K>::absorb(Node* node) {
+    Node* const next = node->next;
+
+    std::uninitialized_move(next->items(), next->items() + next->used, node->items() + node->used);
+    std::destroy(next->items(), next->items() + next->used);
+    node->used += next->used;
+    unlink_node(next);
+}
+
+// constructs a copy of value at index in node, shifting later ones up
+template <class T, std::size_t K>
+void UnrolledList<T, K>::place(Node* node, size_type index, const value_type& value) {
+    T* const items = node->items();
+    const size_type last = node->used;
+
+    if (index == last) {
+        ::new (static_cast<void*>(items + last)) T(value);
+        ++node->used;
+        return;
+    }
+
+    T copy(value); // value may be one of the elements shifted below
+
+    ::new (static_cast<void*>(items + last)) T(std::move(items[last - 1]));
+    ++node->used;
+    std::move_backward(items + index, items + last - 1, items + last);
+    items[index] = std::move(copy);
+}
+
+template <class T, std::size_t K>
+bool operator==(const UnrolledList<T, K>& lhs, const UnrolledList<T, K>& rhs) {
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class T, std::size_t K>
+bool operator!=(const UnrolledList<T, K>& lhs, const UnrolledList<T, K>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <class T, std::size_t K>
+std::ostream& operator<<(std::ostream& output, const UnrolledList<T, K>& list) {
+    output << '{';
+
+    BufferedWriter writer(output);
+
+    for (auto itr = list.begin(); itr != list.end(); ++itr) {
+        if (itr != list.begin()) {
+            writer.put(',');
+        }
+        writer.write(*itr);
+    }
+    writer.put('}');
+
+    return output;
+}
+
+#endif
@@ -0,0 +1,197 @@
+/// @file BitContainer-test.cpp
+/// @brief Catch2 Unit tests for the bit-packed BitContainer
+
+#define CATCH_CONFIG_MAIN
+#if defined __linux__
+#include <catch.hpp>
+#elif defined __MACH__
+#include </opt/local/include/catch2/catch.hpp>
+#else
+#include "catch.hpp"
+#endif
+
+#include <algorithm>
+#include <initializer_list>
+#include <sstream>
+#include <vector>
+
+#include "BitContainer.hpp"
+#include "BitContainer.hpp"  // check include guard
+
+namespace {
+/// Builds a BitContainer and a reference vector<bool> from the same pattern.
+std::pair<BitContainer<>, std::vector<bool>> pattern(std::size_t count, unsigned seed) {
+    BitContainer<> bits{};
+    std::vector<bool> expected{};
+
+    for (std::size_t pos = 0; pos < count; ++pos) {
+        const bool value = (pos * seed + pos / 7) % 3 == 0;
+
+        bits.push_back(value);
+        expected.push_back(value);
+    }
+    return { bits, expected };
+}
+}  // namespace
+
+TEST_CASE("BitContainer()") {
+    const BitContainer<> box1{};
+
+    CHECK(box1.size() == 0);
+    CHECK(box1.empty() == true);
+    CHECK(box1.count() == 0);
+    CHECK(box1.find_first() == 0);
+    CHECK(box1.begin() == box1.end());
+    CHECK_THROWS_AS(box1.at(0), std::out_of_range);
+
+    const BitContainer<> box2(1000);
+    CHECK(box2.size() == 0);
+    CHECK(box2.capacity() >= 1000);
+}
+
+TEST_CASE("BitContainer packs 64 bits to a word") {
+    const BitContainer<> box1 { true, false, true, true };
+
+    REQUIRE(box1.size() == 4);
+    CHECK(box1.data()[0] == 0b1101);
+    CHECK(box1[0] == true);
+    CHECK(box1[1] == false);
+    CHECK(box1.at(3) == true);
+
+    auto [box2, expected] = pattern(1000, 5);
+    REQUIRE(box2.size() == 1000);
+    CHECK(std::equal(box2.begin(), box2.end(), expected.begin(), expected.end()));
+    CHECK(box2.capacity() >= 1000);
+    CHECK(box2.capacity() < 1000 * 2);
+}
+
+TEST_CASE("BitContainer set(), flip() and the reference proxy") {
+    BitContainer<> box1{};
+    box1.resize(130);
+
+    box1.set(0);
+    box1.set(64);
+    box1[129] = true;
+    box1.flip(1);
+    CHECK(box1.count() == 4);
+
+    box1[2] = box1[0];
+    CHECK(box1[2] == true);
+
+    box1.set(0, false);
+    box1.flip(129);
+    CHECK(box1.count() == 3);
+    CHECK_THROWS_AS(box1.set(130), std::out_of_range);
+
+    box1.flip();
+    CHECK(box1.count() == 127);
+    box1.reset();
+    CHECK(box1.none() == true);
+
+    std::fill(box1.begin(), box1.end(), true);
+    CHECK(box1.all() == true);
+}
+
+TEST_CASE("BitContainer count(), find_first() and find_next()") {
+    for (std::size_t count : { 1, 63, 64, 65, 200, 1000 }) {
+        auto [box1, expected] = pattern(count, 7);
+
+        CHECK(box1.count() == static_cast<std::size_t>(std::count(expected.begin(), expected.end(), true)));
+
+        std::vector<std::size_t> set_bits{};
+        for (auto pos = box1.find_first(); pos != box1.size(); pos = box1.find_next(pos)) {
+            set_bits.push_back(pos);
+        }
+        std::vector<std::size_t> wanted{};
+        for (std::size_t pos = 0; pos < count; ++pos) {
+            if (expected[pos]) {
+                wanted.push_back(pos);
+            }
+        }
+        CHECK(set_bits == wanted);
+
+        const auto zero = std::find(expected.begin(), expected.end(), false) - expected.begin();
+        CHECK(box1.find(false).index() == static_cast<std::size_t>(zero));
+        CHECK(box1.find(true, 10).index() == box1.find_next(9));
+    }
+
+    BitContainer<> box2{};
+    box2.resize(100, true);
+    CHECK(box2.find(false) == box2.end());
+    CHECK(box2.find_next(99) == 100);
+}
+
+TEST_CASE("BitContainer push_back(), pop_back() and resize()") {
+    BitContainer<> box1{};
+    box1.resize(70, true);
+    CHECK(box1.count() == 70);
+
+    box1.resize(10);
+    box1.resize(100, true);
+    CHECK(box1.count() == 100);
+
+    box1.resize(65);
+    box1.resize(128);
+    CHECK(box1.count() == 65);
+
+    while (box1.size() > 60) {
+        box1.pop_back();
+    }
+    CHECK(box1.count() == 60);
+    CHECK(box1.data()[0] == (std::uint64_t{1} << 60) - 1);
+
+    box1.clear();
+    CHECK(box1.empty() == true);
+    CHECK_THROWS_AS(box1.pop_back(), std::out_of_range);
+}
+
+TEST_CASE("BitContainer AND, OR, XOR and NOT") {
+    auto [box1, bits1] = pattern(300, 5);
+    auto [box2, bits2] = pattern(300, 11);
+
+    const BitContainer<> both = box1 & box2;
+    const BitContainer<> either = box1 | box2;
+    const BitContainer<> one = box1 ^ box2;
+    const BitContainer<> inverse = ~box1;
+
+    for (std::size_t pos = 0; pos < 300; ++pos) {
+        CHECK(both[pos] == (bits1[pos] && bits2[pos]));
+        CHECK(either[pos] == (bits1[pos] || bits2[pos]));
+        CHECK(one[pos] == (bits1[pos] != bits2[pos]));
+        CHECK(inverse[pos] == !bits1[pos]);
+    }
+    CHECK(inverse.count() == 300 - box1.count());
+    CHECK((box1 ^ box1).none() == true);
+
+    const BitContainer<> shorter { true };
+    CHECK_THROWS_AS(box1 &= shorter, std::invalid_argument);
+}
+
+TEST_CASE("BitContainer operator+= and operator==") {
+    for (std::size_t split : { 0, 1, 63, 64, 100 }) {
+        auto [head, head_bits] = pattern(split, 5);
+        auto [tail, tail_bits] = pattern(150, 3);
+
+        head += tail;
+        head_bits.insert(head_bits.end(), tail_bits.begin(), tail_bits.end());
+        CHECK(std::equal(head.begin(), head.end(), head_bits.begin(), head_bits.end()));
+
+        const BitContainer<> copy { head };
+        head += head;
+        CHECK(head.size() == 2 * copy.size());
+        CHECK(std::equal(copy.begin(), copy.end(), head.begin() + copy.size()));
+    }
+
+    CHECK((BitContainer<>{ true, false }) == (BitContainer<>{ true, false }));
+    CHECK((BitContainer<>{ true, false }) != (BitContainer<>{ true, true }));
+    CHECK((BitContainer<>{ true, false }) != (BitContainer<>{ true, false, false }));
+}
+
+TEST_CASE("std::ostream& operator<<(std::ostream&, const BitContainer&)") {
+    std::ostringstream output{};
+
+    output << BitContainer<>{ true, false, true };
+    CHECK(output.str() == "{1,0,1}");
+}
+
+/* EOF */
@@ -0,0 +1,602 @@
+/// @file BitContainer.hpp
+/// @author Brandon Timok <8000477724@student.csn.edu>
+/// @date 03/14/2022
+/// @brief A BitContainer stores flags one bit each, packed into 64-bit
+/// words, so counting, searching and set algebra run a word at a time.
+
+#ifndef BIT_CONTAINER_HPP
+#define BIT_CONTAINER_HPP
+#include <initializer_list>
+#include <iostream>
+#include <cstdlib>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <stdexcept>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include "Container.hpp"
+#include "../common/BufferedWriter.hpp"
+
+/// A Container of bools packed 64 to a word.
+///
+/// Bit i lives in word i / 64 at position i % 64. The bits of the last word
+/// past size() are always 0, so count(), find_first(), operator== and the
+/// bitwise operators work on whole words without masking.
+/// @tparam Growth policy deciding the new capacity, in words, when full.
+template <class Growth = DoublingGrowth>
+class BitContainer {
+    template <bool Const>
+    class Iterator;
+
+public:
+    class reference;
+
+    /// Member types.
+    using value_type      = bool;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_reference = bool;
+    using word_type       = std::uint64_t;
+    using iterator        = Iterator<false>;
+    using const_iterator  = Iterator<true>;
+
+    /// Number of bits in a word.
+    static constexpr size_type word_bits = std::numeric_limits<word_type>::digits;
+
+    /// Default ctor. Reserves room for count bits without adding any.
+    BitContainer(size_type count = 0) : words(word_count(count)) {}
+
+    /// Initializer List ctor
+    BitContainer(const std::initializer_list<bool>& init);
+
+    /// Checks if the container has no elements, e.g begin() == end()
+    /// @returns true if the container is empty, false otherwise.
+    bool empty() const { return used == 0; }
+
+    /// Returns the number of bits in the container.
+    size_type size() const { return used; }
+
+    /// Returns the number of bits that can be held without reallocating.
+    size_type capacity() const { return words.capacity() * word_bits; }
+
+    /// Grows the storage to hold at least new_cap bits. Never shrinks.
+    void reserve(size_type new_cap) { words.reserve(word_count(new_cap)); }
+
+    /// Releases the words that hold no bits.
+    void shrink_to_fit() { words.shrink_to_fit(); }
+
+    /// Returns an iterator to the first bit.
+    iterator begin() { return { this, 0 }; }
+    const_iterator begin() const { return { this, 0 }; }
+
+    /// Returns an iterator to the end (the bit following the last bit).
+    iterator end() { return { this, used }; }
+    const_iterator end() const { return { this, used }; }
+
+    /// Returns the packed words; the bits past size() are 0.
+    const word_type* data() const { return words.begin(); }
+
+    /// Adds a bit to the end.
+    void push_back(bool value);
+
+    /// Removes the last bit.
+    void pop_back();
+
+    /// Resizes the container to hold count bits; new bits are set to value.
+    void resize(size_type count, bool value = false);
+
+    /// Removes every bit.
+    void clear();
+
+    /// Sets the bit at pos to value.
+    /// @throws std::out_of_range if pos is not below size().
+    void set(size_type pos, bool value = true) { at(pos) = value; }
+
+    /// Sets every bit to 0.
+    void reset();
+
+    /// Toggles the bit at pos.
+    /// @throws std::out_of_range if pos is not below size().
+    void flip(size_type pos) { at(pos).flip(); }
+
+    /// Toggles every bit.
+    void flip();
+
+    /// Returns the number of bits set (the population count).
+    size_type count() const;
+
+    /// Checks whether every bit, some bit, or no bit is set.
+    bool all() const { return count() == used; }
+    bool any() const { return find_first() != used; }
+    bool none() const { return !any(); }
+
+    /// Returns the index of the first set bit, or size() if there is none.
+    size_type find_first() const { return find_next_from(0); }
+
+    /// Returns the index of the first set bit after pos, or size() if there is none.
+    size_type find_next(size_type pos) const { return find_next_from(pos + 1); }
+
+    /// Finds the first bit equal to the given target. Search begins at pos.
+    /// @returns iterator to the bit if found, or end() if not found.
+    iterator find(bool target, size_type pos = 0);
+    const_iterator find(bool target, size_type pos = 0) const;
+
+    /// Combines each bit with the matching bit of other, a word at a time.
+    /// @throws std::invalid_argument if the sizes differ.
+    BitContainer& operator&=(const BitContainer& other);
+    BitContainer& operator|=(const BitContainer& other);
+    BitContainer& operator^=(const BitContainer& other);
+
+    /// Appends the bits of other.
+    /// @returns this
+    BitContainer& operator+=(const BitContainer& other);
+
+    /// Returns the bit at the index chosen.
+    /// Checks for out of bounds.
+    reference at(size_type pos);
+    bool at(size_type pos) const;
+
+    /// Returns the bit at the index chosen.
+    /// Does not check for bounds.
+    reference operator[](size_type pos) { return { words.begin() + pos / word_bits, pos % word_bits }; }
+    bool operator[](size_type pos) const { return (words[pos / word_bits] >> (pos % word_bits)) & 1; }
+
+    /// Equality comparison operator, a word at a time.
+    /// @returns true if lhs compares equal to rhs, otherwise false
+    friend bool operator==(const BitContainer& lhs, const BitContainer& rhs) {
+        return lhs.used == rhs.used && lhs.words == rhs.words;
+    }
+
+private:
+    /// Returns the number of words holding count bits.
+    static size_type word_count(size_type count) { return (count + word_bits - 1) / word_bits; }
+
+    /// Returns the number of bits set in word.
+    static size_type popcount(word_type word);
+
+    /// Returns the position of the lowest set bit of word, which is not 0.
+    static size_type lowest_bit(word_type word);
+
+    /// Returns the index of the first set bit at or after pos, or size().
+    size_type find_next_from(size_type pos) const;
+
+    /// Clears the bits of the last word past size().
+    void trim();
+
+    /// Checks that other has the same size, for the bitwise operators.
+    void check_size(const BitContainer& other) const;
+
+    Container<word_type, Growth> words{}; ///< Packed bits; spare bits are 0.
+    size_type                    used = 0; ///< Number of bits in container.
+};
+
+/// Proxy for a single bit, returned by the mutable accessors.
+template <class G>
+class BitContainer<G>::reference {
+public:
+    reference(word_type* word, size_type bit) : word(word), mask(word_type{1} << bit) {}
+
+    reference(const reference&) = default;
+
+    operator bool() const { return (*word & mask) != 0; }
+
+    reference& operator=(bool value) {
+        *word = value ? *word | mask : *word & ~mask;
+        return *this;
+    }
+
+    /// Assigns the bit other refers to, not the proxy itself.
+    reference& operator=(const reference& other) { return *this = bool(other); }
+
+    /// Toggles the bit.
+    void flip() { *word ^= mask; }
+
+    /// Swaps the bits two proxies refer to.
+    friend void swap(reference lhs, reference rhs) {
+        const bool value = lhs;
+        lhs = bool(rhs);
+        rhs = value;
+    }
+
+private:
+    word_type* word; ///< Word holding the bit.
+    word_type  mask; ///< The bit within the word.
+};
+
+/// Random access iterator over a BitContainer. Dereferencing a mutable one
+/// yields a reference proxy, a const one a bool.
+template <class G>
+template <bool Const>
+class BitContainer<G>::Iterator {
+    using owner_type = std::conditional_t<Const, const BitContainer, BitContainer>;
+
+public:
+    // member types
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = bool;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference         = std::conditional_t<Const, bool, typename BitContainer::reference>;
+
+    Iterator() = default;
+    Iterator(owner_type* owner, size_type pos) : owner(owner), pos(pos) {}
+
+    /// A mutable iterator converts to a const one.
+    template <bool C = Const, class = std::enable_if_t<!C>>
+    operator Iterator<true>() const { return { owner, pos }; }
+
+    /// Returns the index of the bit referred to.
+    size_type index() const { return pos; }
+
+    reference operator*() const { return (*owner)[pos]; }
+    reference operator[](difference_type n) const { return (*owner)[pos + n]; }
+
+    Iterator& operator++() { ++pos; return *this; }
+    Iterator operator++(int) { Iterator tmp = *this; ++pos; return tmp; }
+    Iterator& operator--() { --pos; return *this; }
+    Iterator operator--(int) { Iterator tmp = *this; --pos; return tmp; }
+
+    Iterator& operator+=(difference_type n) { pos += n; return *this; }
+    Iterator& operator-=(difference_type n) { pos -= n; return *this; }
+
+    friend Iterator operator+(Iterator itr, difference_type n) { return itr += n; }
+    friend Iterator operator+(difference_type n, Iterator itr) { return itr += n; }
+    friend Iterator operator-(Iterator itr, difference_type n) { return itr -= n; }
+
+    friend difference_type operator-(const Iterator& lhs, const Iterator& rhs) {
+        return static_cast<difference_type>(lhs.pos) - static_cast<difference_type>(rhs.pos);
+    }
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) { return lhs.pos == rhs.pos; }
+    friend bool operator!=(const Iterator& lhs, const Iterator& rhs) { return lhs.pos != rhs.pos; }
+    friend bool operator<(const Iterator& lhs, const Iterator& rhs) { return lhs.pos < rhs.pos; }
+    friend bool operator>(const Iterator& lhs, const Iterator& rhs) { return lhs.pos > rhs.pos; }
+    friend bool operator<=(const Iterator& lhs, const Iterator& rhs) { return lhs.pos <= rhs.pos; }
+    friend bool operator>=(const Iterator& lhs, const Iterator& rhs) { return lhs.pos >= rhs.pos; }
+
+private:
+    owner_type* owner = nullptr; ///< Container iterated over.
+    size_type   pos = 0;         ///< Index of the bit referred to.
+};
+
+// related non-member functions
+
+/// Inequality comparison operator.
+/// @returns true if lhs does not compare equal to rhs, otherwise false
+template <class G>
+bool operator!=(const BitContainer<G>& lhs, const BitContainer<G>& rhs);
+
+/// Returns the bitwise AND, OR or XOR of two containers of the same size.
+/// @throws std::invalid_argument if the sizes differ.
+template <class G>
+BitContainer<G> operator&(BitContainer<G> lhs, const BitContainer<G>& rhs);
+template <class G>
+BitContainer<G> operator|(BitContainer<G> lhs, const BitContainer<G>& rhs);
+template <class G>
+BitContainer<G> operator^(BitContainer<G> lhs, const BitContainer<G>& rhs);
+
+/// Returns a copy of rhs with every bit toggled.
+template <class G>
+BitContainer<G> operator~(BitContainer<G> rhs);
+
+/// Writes a formatted representation of rhs to output, one digit per bit.
+/// @returns output
+template <class G>
+std::ostream& operator<<(std::ostream& output, const BitContainer<G>& oset);
+
+// ============================================================================
+
+/// Initializer List ctor
+template <class G>
+BitContainer<G>::BitContainer(const std::initializer_list<bool>& init) : BitContainer(init.size()) {
+    for (bool value : init) {
+        push_back(value);
+    }
+}
+
+/// Returns the number of bits set in word.
+template <class G>
+typename BitContainer<G>::size_type BitContainer<G>::popcount(word_type word) {
+#if defined __GNUC__ || defined __clang__
+    return __builtin_popcountll(word);
+#else
+    size_type bits = 0;
+
+    for (; word != 0; word &= word - 1) {
+        ++bits;
+    }
+    return bits;
+#endif
+}
+
+/// Returns the position of the lowest set bit of word, which is not 0.
+template <class G>
+typename BitContainer<G>::size_type BitContainer<G>::lowest_bit(word_type word) {
+#if defined __GNUC__ || defined __clang__
+    return __builtin_ctzll(word);
+#else
+    size_type bit = 0;
+
+    for (; (word & 1) == 0; word >>= 1) {
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+/// Adds a bit to the end.
+template <class G>
+void BitContainer<G>::push_back(bool value) {
+    if (used % word_bits == 0) {
+        words.push_back(0);
+    }
+    if (value) {
+        words[used / word_bits] |= word_type{1} << (used % word_bits);
+    }
+    ++used;
+}
+
+/// Removes the last bit.
+template <class G>
+void BitContainer<G>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("pop_back on empty BitContainer");
+    }
+    --used;
+    if (used % word_bits == 0) {
+        words.pop_back();
+    } else {
+        trim();
+    }
+}
+
+/// Resizes the container to hold count bits; new bits are set to value.
+template <class G>
+void BitContainer<G>::resize(size_type count, bool value) {
+    const size_type old_used = used;
+
+    words.resize(word_count(count), value ? ~word_type{0} : 0);
+    used = count;
+
+    if (value && count > old_used && old_used % word_bits != 0) {
+        // the spare bits of the old last word are 0 and now in use
+        words[old_used / word_bits] |= ~word_type{0} << (old_used % word_bits);
+    }
+    trim();
+}
+
+/// Removes every bit.
+template <class G>
+void BitContainer<G>::clear() {
+    words.clear();
+    used = 0;
+}
+
+/// Sets every bit to 0.
+template <class G>
+void BitContainer<G>::reset() {
+    std::fill(words.begin(), words.end(), word_type{0});
+}
+
+/// Toggles every bit.
+template <class G>
+void BitContainer<G>::flip() {
+    for (word_type& word : words) {
+        word = ~word;
+    }
+    trim();
+}
+
+/// Returns the number of bits set (the population count).
+template <class G>
+typename BitContainer<G>::size_type BitContainer<G>::count() const {
+    size_type bits = 0;
+
+    for (word_type word : words) {
+        bits += popcount(word);
+    }
+    return bits;
+}
+
+/// Returns the index of the first set bit at or after pos, or size().
+template <class G>
+typename BitContainer<G>::size_type BitContainer<G>::find_next_from(size_type pos) const {
+    if (pos >= used) {
+        return used;
+    }
+
+    size_type index = pos / word_bits;
+    // drop the bits below pos in the first word
+    word_type word = words[index] & (~word_type{0} << (pos % word_bits));
+
+    while (word == 0) {
+        if (++index == words.size()) {
+            return used;
+        }
+        word = words[index];
+    }
+    return index * word_bits + lowest_bit(word);
+}
+
+/// Finds the first bit equal to the given target. Search begins at pos.
+/// @returns iterator to the bit if found, or end() if not found.
+template <class G>
+typename BitContainer<G>::iterator BitContainer<G>::find(bool target, size_type pos) {
+    if (target) {
+        return { this, find_next_from(pos) };
+    }
+
+    // look for a set bit in the complement, a word at a time
+    for (size_type index = pos / word_bits; index < words.size() && pos < used; ++index) {
+        const word_type word = ~words[index] & (~word_type{0} << (pos % word_bits));
+
+        if (word != 0) {
+            return { this, std::min(used, index * word_bits + lowest_bit(word)) };
+        }
+        pos = (index + 1) * word_bits;
+    }
+    return end();
+}
+
+///
+template <class G>
+typename BitContainer<G>::const_iterator BitContainer<G>::find(bool target, size_type pos) const {
+    return const_cast<BitContainer*>(this)->find(target, pos);
+}
+
+/// Clears the bits of the last word past size().
+template <class G>
+void BitContainer<G>::trim() {
+    if (used % word_bits != 0) {
+        words[used / word_bits] &= ~(~word_type{0} << (used % word_bits));
+    }
+}
+
+/// Checks that other has the same size, for the bitwise operators.
+template <class G>
+void BitContainer<G>::check_size(const BitContainer& other) const {
+    if (used != other.used) {
+        throw std::invalid_argument("BitContainer sizes differ");
+    }
+}
+
+///
+template <class G>
+BitContainer<G>& BitContainer<G>::operator&=(const BitContainer& other) {
+    check_size(other);
+    for (size_type index = 0; index < words.size(); ++index) {
+        words[index] &= other.words[index];
+    }
+    return *this;
+}
+
+///
+template <class G>
+BitContainer<G>& BitContainer<G>::operator|=(const BitContainer& other) {
+    check_size(other);
+    for (size_type index = 0; index < words.size(); ++index) {
+        words[index] |= other.words[index];
+    }
+    return *this;
+}
+
+///
+template <class G>
+BitContainer<G>& BitContainer<G>::operator^=(const BitContainer& other) {
+    check_size(other);
+    for (size_type index = 0; index < words.size(); ++index) {
+        words[index] ^= other.words[index];
+    }
+    return *this;
+}
+
+/// Appends the bits of other.
+/// @returns this
+template <class G>
+BitContainer<G>& BitContainer<G>::operator+=(const BitContainer& other) {
+    if (&other == this) {
+        // the shifted copy below writes into words it has yet to read
+        const BitContainer copy(other);
+        return *this += copy;
+    }
+
+    const size_type shift = used % word_bits;
+    const size_type count = other.used;
+
+    if (shift == 0) {
+        // word aligned: append the words as they are
+        words += other.words;
+    } else {
+        // each word of other straddles two of ours
+        words.reserve(word_count(used + count));
+        for (size_type index = 0; index < other.words.size(); ++index) {
+            const word_type word = other.words[index];
+
+            words[words.size() - 1] |= word << shift;
+            words.push_back(word >> (word_bits - shift));
+        }
+    }
+    used += count;
+    words.resize(word_count(used));
+    return *this;
+}
+
+///
+template <class G>
+typename BitContainer<G>::reference BitContainer<G>::at(size_type pos) {
+    if (pos >= used) {
+        throw std::out_of_range("Out of bounds");
+    }
+    return (*this)[pos];
+}
+
+///
+template <class G>
+bool BitContainer<G>::at(size_type pos) const {
+    if (pos >= used) {
+        throw std::out_of_range("Out of bounds");
+    }
+    return (*this)[pos];
+}
+
+// related non-member functions
+
+/// Inequality comparison operator.
+/// @returns true if lhs does not compare equal to rhs, otherwise false
+template <class G>
+bool operator!=(const BitContainer<G>& lhs, const BitContainer<G>& rhs) {
+    return !(lhs == rhs);
+}
+
+///
+template <class G>
+BitContainer<G> operator&(BitContainer<G> lhs, const BitContainer<G>& rhs) {
+    return lhs &= rhs;
+}
+
+///
+template <class G>
+BitContainer<G> operator|(BitContainer<G> lhs, const BitContainer<G>& rhs) {
+    return lhs |= rhs;
+}
+
+///
+template <class G>
+BitContainer<G> operator^(BitContainer<G> lhs, const BitContainer<G>& rhs) {
+    return lhs ^= rhs;
+}
+
+/// Returns a copy of rhs with every bit toggled.
+template <class G>
+BitContainer<G> operator~(BitContainer<G> rhs) {
+    rhs.flip();
+    return rhs;
+}
+
+/// Writes a formatted representation of rhs to output, one digit per bit.
+/// @returns output
+template <class G>
+std::ostream& operator<<(std::ostream& output, const BitContainer<G>& oset) {
+    output << '{';
+
+    BufferedWriter writer(output);
+
+    for (auto item = oset.begin(); item != oset.end(); ++item) {
+        if (item != oset.begin()) {
+            writer.put(',');
+        }
+        writer.write(bool(*item));
+    }
+
+    writer.put('}');
+
+    return output;
+}
+
+#endif /* BIT_CONTAINER_HPP */
+
+/* EOF */
@@ -0,0 +1,214 @@
+/// @file ConcurrentContainer-test.cpp
+/// @brief Catch2 Unit tests for the append-only ConcurrentContainer
+
+#define CATCH_CONFIG_MAIN
+#if defined __linux__
+#include <catch.hpp>
+#elif defined __MACH__
+#include </opt/local/include/catch2/catch.hpp>
+#else
+#include "catch.hpp"
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <new>
+#include <stdexcept>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ConcurrentContainer.hpp"
+#include "ConcurrentContainer.hpp"  // check include guard
+
+namespace {
+constexpr int THREADS = 8;
+constexpr int PER_THREAD = 5000;
+
+/// When set, the next call to operator new[] throws instead of allocating.
+std::atomic<bool> fail_next_allocation{false};
+
+/// Throws from its constructor when given a negative value.
+struct Picky {
+    Picky(int value) : value(value) {
+        if (value < 0) {
+            throw std::invalid_argument("negative");
+        }
+    }
+
+    int value;
+};
+}  // namespace
+
+// Array new and delete are replaced so a test can make a block allocation
+// fail. Inlined into a new[] site, the forwarding delete[] reads to GCC as a
+// mismatched deallocation, so it stays out of line.
+void* operator new[](std::size_t size) {
+    if (fail_next_allocation.exchange(false)) {
+        throw std::bad_alloc();
+    }
+    return ::operator new(size);
+}
+
+[[gnu::noinline]] void operator delete[](void* block) noexcept {
+    ::operator delete(block);
+}
+
+[[gnu::noinline]] void operator delete[](void* block, std::size_t) noexcept {
+    ::operator delete(block);
+}
+
+TEMPLATE_TEST_CASE("ConcurrentContainer()", "", char, int, double) {
+    const ConcurrentContainer<TestType> box1{};
+
+    CHECK(box1.size() == 0);
+    CHECK(box1.empty() == true);
+    CHECK(box1.begin() == box1.end());
+    CHECK_THROWS_AS(box1.at(0), std::out_of_range);
+}
+
+TEMPLATE_TEST_CASE("ConcurrentContainer push_back() from one thread", "", char, int, double) {
+    ConcurrentContainer<TestType> box1{};
+
+    for (int i = 0; i < 200; ++i) {
+        CHECK(box1.push_back(TestType(i % 100)) == static_cast<std::size_t>(i));
+    }
+
+    REQUIRE(box1.size() == 200);
+    for (std::size_t pos = 0; pos < box1.size(); ++pos) {
+        CHECK(box1[pos] == TestType(pos % 100));
+    }
+    CHECK(box1.at(199) == TestType(99));
+    CHECK_THROWS_AS(box1.at(200), std::out_of_range);
+
+    const TestType EXPECTED[] = { 65, 66, 67 };
+    CHECK(box1.append_range(std::begin(EXPECTED), std::end(EXPECTED)) == 200);
+    CHECK(std::equal(box1.begin() + 200, box1.end(), std::begin(EXPECTED), std::end(EXPECTED)));
+}
+
+TEST_CASE("ConcurrentContainer emplace_back() leaves no hole when it throws") {
+    ConcurrentContainer<int> box1{};
+
+    for (int i = 0; i < 64; ++i) {
+        box1.push_back(i);
+    }
+
+    // the next element needs a new block, and allocating it fails
+    CHECK_THROWS_AS((fail_next_allocation = true, box1.push_back(64)), std::bad_alloc);
+    CHECK(box1.push_back(65) == 64);
+    REQUIRE(box1.size() == 65);
+    CHECK(box1[64] == 65);
+
+    ConcurrentContainer<Picky> box2{};
+
+    CHECK(box2.emplace_back(1) == 0);
+    CHECK_THROWS_AS(box2.emplace_back(-1), std::invalid_argument);
+    CHECK(box2.emplace_back(2) == 1);
+    REQUIRE(box2.size() == 2);
+    CHECK(box2[1].value == 2);
+}
+
+TEST_CASE("ConcurrentContainer push_back() from many threads") {
+    ConcurrentContainer<int> box1{};
+    std::vector<std::thread> workers{};
+
+    for (int id = 0; id < THREADS; ++id) {
+        workers.emplace_back([&box1, id] {
+            for (int i = 0; i < PER_THREAD; ++i) {
+                box1.push_back(id * PER_THREAD + i);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    REQUIRE(box1.size() == THREADS * PER_THREAD);
+
+    // every value exactly once, and each thread's values in the order pushed
+    std::vector<int> seen(box1.begin(), box1.end());
+    std::vector<int> last(THREADS, -1);
+
+    for (int value : seen) {
+        CHECK(value > last[value / PER_THREAD]);
+        last[value / PER_THREAD] = value;
+    }
+    std::sort(seen.begin(), seen.end());
+    for (int i = 0; i < THREADS * PER_THREAD; ++i) {
+        CHECK(seen[i] == i);
+    }
+}
+
+TEST_CASE("ConcurrentContainer append_range() keeps each batch together") {
+    ConcurrentContainer<int> box1{};
+    std::vector<std::thread> workers{};
+    constexpr int BATCH = 100;
+
+    box1.reserve(THREADS * PER_THREAD);
+    for (int id = 0; id < THREADS; ++id) {
+        workers.emplace_back([&box1, id] {
+            std::vector<int> batch(BATCH);
+
+            for (int first = 0; first < PER_THREAD; first += BATCH) {
+                for (int i = 0; i < BATCH; ++i) {
+                    batch[i] = id * PER_THREAD + first + i;
+                }
+                box1.append_range(batch.begin(), batch.end());
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    REQUIRE(box1.size() == THREADS * PER_THREAD);
+    for (std::size_t pos = 0; pos < box1.size(); pos += BATCH) {
+        for (int i = 1; i < BATCH; ++i) {
+            CHECK(box1[pos + i] == box1[pos] + i);
+        }
+    }
+}
+
+TEST_CASE("ConcurrentContainer readers see only finished elements") {
+    ConcurrentContainer<std::string> box1{};
+    std::atomic<bool> done{false};
+    std::atomic<int> bad{0};
+
+    std::thread reader([&] {
+        while (!done.load()) {
+            for (const auto& item : box1) {
+                if (item.compare(0, 5, "item-") != 0) {
+                    ++bad;
+                }
+            }
+        }
+    });
+
+    std::vector<std::thread> workers{};
+    for (int id = 0; id < 4; ++id) {
+        workers.emplace_back([&box1, id] {
+            for (int i = 0; i < 2000; ++i) {
+                box1.emplace_back("item-" + std::to_string(id) + "-" + std::to_string(i)
+                                  + std::string(20, 'x'));
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    done.store(true);
+    reader.join();
+
+    CHECK(bad.load() == 0);
+    CHECK(box1.size() == 8000);
+
+    std::ostringstream output{};
+    ConcurrentContainer<std::string> box2{};
+    box2.push_back("Alpha");
+    box2.push_back("Bravo");
+    output << box2;
+    CHECK(output.str() == "{Alpha,Bravo}");
+}
+
+/* EOF */
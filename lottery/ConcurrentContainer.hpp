@@ -0,0 +1,380 @@
+/// @file ConcurrentContainer.hpp
+/// @author Brandon Timok <8000477724@student.csn.edu>
+/// @date 03/14/2022
+/// @brief A ConcurrentContainer is an append-only Container that many threads
+/// can push_back into at once without a lock, while others read the part
+/// that has already been published.
+
+#ifndef CONCURRENT_CONTAINER_HPP
+#define CONCURRENT_CONTAINER_HPP
+#include <iostream>
+#include <cstdlib>
+#include <cstddef>
+#include <atomic>
+#include <utility>
+#include <stdexcept>
+#include <algorithm>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "SegmentedContainer.hpp"
+#include "../common/BufferedWriter.hpp"
+
+/// An append-only Container for many writers and readers.
+///
+/// A writer makes sure the block under the cursor is allocated (a
+/// compare-and-swap decides which thread's block is kept), then claims the
+/// slot by advancing the cursor with a compare-and-swap, constructs the
+/// element in it and marks the slot ready. Nothing that can throw happens
+/// between claiming a slot and marking it ready, so no slot is left empty. size() is the length of the published prefix: every slot below it
+/// is ready, so readers may iterate over [begin(), end()) while writers keep
+/// appending. Elements never move, so references stay valid.
+///
+/// Only construction and destruction of the container itself must not race
+/// with other calls.
+template <class T>
+class ConcurrentContainer {
+    static_assert(std::is_nothrow_move_constructible<T>::value,
+                  "ConcurrentContainer needs a nothrow move constructor");
+
+    /// Storage for one element and the flag that publishes it.
+    struct Slot {
+        alignas(T) unsigned char storage[sizeof(T)];
+        std::atomic<bool>        ready{false};
+    };
+
+    using layout = DoublingBlocks<6>;
+
+public:
+    class const_iterator;
+
+    /// Member types.
+    using value_type = T;
+    using size_type  = std::size_t;
+    using iterator   = const_iterator;
+
+    /// Default ctor. Allocates nothing.
+    ConcurrentContainer() = default;
+
+    ConcurrentContainer(const ConcurrentContainer&) = delete;
+    ConcurrentContainer& operator=(const ConcurrentContainer&) = delete;
+
+    /// Destructor. No other thread may be using the container.
+    ~ConcurrentContainer();
+
+    /// Checks if no element has been published yet.
+    bool empty() const { return size() == 0; }
+
+    /// Returns the length of the published prefix: the elements at indices
+    /// below size() are fully constructed and visible to the caller.
+    size_type size() const { return published.load(); }
+
+    /// Allocates the blocks for the first new_cap elements ahead of time.
+    void reserve(size_type new_cap);
+
+    /// Returns an iterator to the first element.
+    const_iterator begin() const { return { this, 0 }; }
+
+    /// Returns an iterator past the published prefix as of this call.
+    const_iterator end() const { return { this, size() }; }
+
+    /// Adds an element to the end. Safe to call from many threads.
+    /// @returns the index of the new element.
+    size_type push_back(const value_type& value) { return emplace_back(value); }
+    size_type push_back(value_type&& value) { return emplace_back(std::move(value)); }
+
+    /// Constructs an element at the end from args. Safe to call from many threads.
+    /// If allocating a new block or constructing the element throws, no slot
+    /// is claimed.
+    /// @returns the index of the new element.
+    template <class... Args>
+    size_type emplace_back(Args&&... args);
+
+    /// Adds copies of the items in [first, last) in consecutive slots, claimed
+    /// with a single advance of the cursor. Safe to call from many threads.
+    /// @returns the index of the first new element.
+    template <class ForwardIt>
+    size_type append_range(ForwardIt first, ForwardIt last);
+
+    /// Returns the value at the index chosen.
+    /// @throws std::out_of_range if pos is not below size().
+    T& at(size_type pos);
+    const T& at(size_type pos) const;
+
+    /// Returns the value at the index chosen, which must be below size().
+    T& operator[](size_type pos) { return element(slot(pos)); }
+    const T& operator[](size_type pos) const { return element(slot(pos)); }
+
+private:
+    /// Returns the slot for index pos, whose block must exist.
+    Slot& slot(size_type pos) const;
+
+    /// Returns the slot for index pos, allocating its block if needed.
+    Slot& claim(size_type pos);
+
+    /// Advances the cursor by count once the blocks for the new slots exist.
+    /// @returns the index of the first slot taken.
+    size_type take(size_type count);
+
+    /// Returns the element stored in slot, which must be ready.
+    static T& element(Slot& slot) { return *std::launder(reinterpret_cast<T*>(slot.storage)); }
+
+    /// Constructs an element in slot from args and marks the slot ready.
+    template <class... Args>
+    static void fill(Slot& slot, Args&&... args);
+
+    /// Advances the published prefix over every ready slot.
+    void publish();
+
+    std::atomic<Slot*>     blocks[layout::max_blocks]{}; ///< Allocated lazily.
+    std::atomic<size_type> cursor{0};    ///< Next index to hand out.
+    std::atomic<size_type> published{0}; ///< Slots below this are ready.
+};
+
+/// Iterates over the published prefix of a ConcurrentContainer.
+template <class T>
+class ConcurrentContainer<T>::const_iterator {
+public:
+    // member types
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const T*;
+    using reference         = const T&;
+
+    const_iterator() = default;
+    const_iterator(const ConcurrentContainer* owner, size_type pos) : owner(owner), pos(pos) {}
+
+    reference operator*() const { return (*owner)[pos]; }
+    pointer operator->() const { return &(*owner)[pos]; }
+    reference operator[](difference_type n) const { return (*owner)[pos + n]; }
+
+    const_iterator& operator++() { ++pos; return *this; }
+    const_iterator operator++(int) { const_iterator tmp = *this; ++pos; return tmp; }
+    const_iterator& operator--() { --pos; return *this; }
+    const_iterator operator--(int) { const_iterator tmp = *this; --pos; return tmp; }
+
+    const_iterator& operator+=(difference_type n) { pos += n; return *this; }
+    const_iterator& operator-=(difference_type n) { pos -= n; return *this; }
+
+    friend const_iterator operator+(const_iterator itr, difference_type n) { return itr += n; }
+    friend const_iterator operator+(difference_type n, const_iterator itr) { return itr += n; }
+    friend const_iterator operator-(const_iterator itr, difference_type n) { return itr -= n; }
+
+    friend difference_type operator-(const const_iterator& lhs, const const_iterator& rhs) {
+        return static_cast<difference_type>(lhs.pos) - static_cast<difference_type>(rhs.pos);
+    }
+
+    friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) {
+        return lhs.pos == rhs.pos;
+    }
+    friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs) {
+        return lhs.pos != rhs.pos;
+    }
+    friend bool operator<(const const_iterator& lhs, const const_iterator& rhs) {
+        return lhs.pos < rhs.pos;
+    }
+
+private:
+    const ConcurrentContainer* owner = nullptr; ///< Container iterated over.
+    size_type                  pos = 0;         ///< Index of the element referred to.
+};
+
+// related non-member functions
+
+/// Writes a formatted representation of the published prefix of oset to output.
+/// @returns output
+template <class T>
+std::ostream& operator<<(std::ostream& output, const ConcurrentContainer<T>& oset);
+
+// ============================================================================
+
+/// Destructor. No other thread may be using the container.
+template <class T>
+ConcurrentContainer<T>::~ConcurrentContainer() {
+    for (size_type k = 0; k < layout::max_blocks; ++k) {
+        Slot* block = blocks[k].load();
+
+        if (block == nullptr) {
+            continue;
+        }
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (size_type offset = 0; offset < layout::block_size(k); ++offset) {
+                if (block[offset].ready.load(std::memory_order_relaxed)) {
+                    element(block[offset]).~value_type();
+                }
+            }
+        }
+        delete[] block;
+    }
+}
+
+/// Allocates the blocks for the first new_cap elements ahead of time.
+template <class T>
+void ConcurrentContainer<T>::reserve(size_type new_cap) {
+    for (size_type k = 0; layout::block_start(k) < new_cap; ++k) {
+        claim(layout::block_start(k));
+    }
+}
+
+/// Returns the slot for index pos, whose block must exist.
+template <class T>
+typename ConcurrentContainer<T>::Slot& ConcurrentContainer<T>::slot(size_type pos) const {
+    const auto [block, offset] = layout::locate(pos);
+    return blocks[block].load(std::memory_order_acquire)[offset];
+}
+
+/// Returns the slot for index pos, allocating its block if needed.
+template <class T>
+typename ConcurrentContainer<T>::Slot& ConcurrentContainer<T>::claim(size_type pos) {
+    const auto [block, offset] = layout::locate(pos);
+
+    if (block >= layout::max_blocks) {
+        throw std::length_error("ConcurrentContainer is full");
+    }
+
+    Slot* current = blocks[block].load(std::memory_order_acquire);
+
+    if (current == nullptr) {
+        // race to install a block; the losers free theirs and use the winner's
+        Slot* fresh = new Slot[layout::block_size(block)];
+
+        if (blocks[block].compare_exchange_strong(current, fresh)) {
+            current = fresh;
+        } else {
+            delete[] fresh;
+        }
+    }
+    return current[offset];
+}
+
+/// Advances the cursor by count once the blocks for the new slots exist.
+/// @returns the index of the first slot taken.
+template <class T>
+typename ConcurrentContainer<T>::size_type ConcurrentContainer<T>::take(size_type count) {
+    size_type start = cursor.load();
+
+    do {
+        // allocate before advancing the cursor: a throw here leaves no hole
+        for (size_type pos = start; pos < start + count; ) {
+            claim(pos);
+            pos = layout::block_start(layout::locate(pos).first + 1);
+        }
+    } while (!cursor.compare_exchange_weak(start, start + count));
+    return start;
+}
+
+/// Constructs an element in slot from args and marks the slot ready.
+template <class T>
+template <class... Args>
+void ConcurrentContainer<T>::fill(Slot& slot, Args&&... args) {
+    ::new (static_cast<void*>(slot.storage)) value_type(std::forward<Args>(args)...);
+    slot.ready.store(true);
+}
+
+/// Advances the published prefix over every ready slot.
+template <class T>
+void ConcurrentContainer<T>::publish() {
+    // The flags and the prefix use sequentially consistent operations: a
+    // writer that stops at a slot which is not ready yet is then guaranteed
+    // that the slot's own writer sees the advanced prefix and carries on.
+    size_type done = published.load();
+
+    while (done < cursor.load()) {
+        const auto [block, offset] = layout::locate(done);
+        Slot* current = blocks[block].load();
+
+        if (current == nullptr || !current[offset].ready.load()) {
+            return;
+        }
+        // on failure done is reloaded, and the loop re-checks from there
+        if (published.compare_exchange_weak(done, done + 1)) {
+            ++done;
+        }
+    }
+}
+
+/// Constructs an element at the end from args.
+/// @returns the index of the new element.
+template <class T>
+template <class... Args>
+typename ConcurrentContainer<T>::size_type ConcurrentContainer<T>::emplace_back(Args&&... args) {
+    size_type pos = 0;
+
+    if constexpr (std::is_nothrow_constructible<value_type, Args&&...>::value) {
+        pos = take(1);
+        fill(slot(pos), std::forward<Args>(args)...);
+    } else {
+        // build the value before taking a slot: a throw here leaves no hole
+        value_type value(std::forward<Args>(args)...);
+
+        pos = take(1);
+        fill(slot(pos), std::move(value));
+    }
+    publish();
+    return pos;
+}
+
+/// Adds copies of the items in [first, last) in consecutive slots.
+/// @returns the index of the first new element.
+template <class T>
+template <class ForwardIt>
+typename ConcurrentContainer<T>::size_type
+ConcurrentContainer<T>::append_range(ForwardIt first, ForwardIt last) {
+    // copy the batch before taking slots: a throw here leaves no hole
+    std::vector<value_type> batch(first, last);
+    const size_type start = take(batch.size());
+
+    for (size_type index = 0; index < batch.size(); ++index) {
+        fill(slot(start + index), std::move(batch[index]));
+    }
+    publish();
+    return start;
+}
+
+///
+template <class T>
+T& ConcurrentContainer<T>::at(size_type pos) {
+    if (pos >= size()) {
+        throw std::out_of_range("Out of bounds");
+    }
+    return (*this)[pos];
+}
+
+///
+template <class T>
+const T& ConcurrentContainer<T>::at(size_type pos) const {
+    if (pos >= size()) {
+        throw std::out_of_range("Out of bounds");
+    }
+    return (*this)[pos];
+}
+
+// related non-member functions
+
+/// Writes a formatted representation of the published prefix of oset to output.
+/// @returns output
+template <class T>
+std::ostream& operator<<(std::ostream& output, const ConcurrentContainer<T>& oset) {
+    output << '{';
+
+    BufferedWriter writer(output);
+    const auto first = oset.begin();
+
+    for (auto item = first, last = oset.end(); item != last; ++item) {
+        if (item != first) {
+            writer.put(',');
+        }
+        writer.write(*item);
+    }
+
+    writer.put('}');
+
+    return output;
+}
+
+#endif /* CONCURRENT_CONTAINER_HPP */
+
+/* EOF */
@@ -15,13 +15,93 @@
 #endif
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <initializer_list>
 #include <iomanip>
+#include <iterator>
+#include <list>
+#include <memory_resource>
 #include <sstream>
 #include <string>
 
 #include "Container.hpp"
 
+namespace {
+/// Element type with no default ctor that counts live instances.
+struct Tracked {
+    static int live;
+    int value;
+
+    explicit Tracked(int v) : value(v) { ++live; }
+    Tracked(const Tracked& other) : value(other.value) { ++live; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { other.value = -1; ++live; }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) = default;
+    ~Tracked() { --live; }
+
+    friend bool operator==(const Tracked& lhs, const Tracked& rhs) {
+        return lhs.value == rhs.value;
+    }
+};
+
+int Tracked::live = 0;
+
+/// Trivially copyable element type, moved around as raw bytes.
+struct Point {
+    int    x;
+    double y;
+
+    friend bool operator==(const Point& lhs, const Point& rhs) {
+        return lhs.x == rhs.x && lhs.y == rhs.y;
+    }
+    friend std::ostream& operator<<(std::ostream& output, const Point& point) {
+        return output << '(' << point.x << ' ' << point.y << ')';
+    }
+};
+
+/// Trivially copyable element type with no default ctor.
+struct Tag {
+    explicit Tag(int v) : value(v) {}
+    int value;
+
+    friend bool operator==(const Tag& lhs, const Tag& rhs) { return lhs.value == rhs.value; }
+    friend std::ostream& operator<<(std::ostream& output, const Tag& tag) {
+        return output << tag.value;
+    }
+};
+
+/// Allocator on malloc with a reallocate() hook that counts its calls.
+template <class T>
+struct ReallocAllocator {
+    using value_type = T;
+
+    static int reallocations;
+
+    ReallocAllocator() = default;
+    template <class U>
+    ReallocAllocator(const ReallocAllocator<U>&) {}
+
+    T* allocate(std::size_t count) {
+        return static_cast<T*>(std::malloc(count * sizeof(T)));
+    }
+    void deallocate(T* ptr, std::size_t) { std::free(ptr); }
+
+    T* reallocate(T* ptr, std::size_t, std::size_t count) {
+        ++reallocations;
+        return static_cast<T*>(std::realloc(ptr, count * sizeof(T)));
+    }
+
+    friend bool operator==(const ReallocAllocator&, const ReallocAllocator&) { return true; }
+    friend bool operator!=(const ReallocAllocator&, const ReallocAllocator&) { return false; }
+};
+
+template <class T>
+int ReallocAllocator<T>::reallocations = 0;
+}  // namespace
+
 TEMPLATE_TEST_CASE("Container(size_type)", "", char, int, double) {
     Container<TestType> box1{};
 
@@ -199,6 +279,188 @@ TEMPLATE_TEST_CASE("push_back()", "", char, int, double) {
     CHECK(std::equal(box1.begin() + SIZE, box1.end(), REF.begin(), REF.end()) == true);
 }
 
+TEMPLATE_TEST_CASE("push_back() geometric growth", "", char, int, double) {
+    Container<TestType> box1{};
+    size_t reallocations = 0;
+    auto previous = box1.capacity();
+
+    for (int i = 0; i < 1000; ++i) {
+        box1.push_back(TestType(i % 100));
+        if (box1.capacity() != previous) {
+            ++reallocations;
+            CHECK(box1.capacity() >= previous * 2);
+            previous = box1.capacity();
+        }
+    }
+
+    CHECK(box1.size() == 1000);
+    CHECK(reallocations <= 8);
+    for (size_t index = 0; index < box1.size(); ++index) {
+        CHECK(box1[index] == TestType(index % 100));
+    }
+}
+
+TEMPLATE_TEST_CASE("push_back() linear growth", "", char, int, double) {
+    Container<TestType, LinearGrowth<4>> box1{};
+
+    for (int i = 0; i < 10; ++i) {
+        box1.push_back(TestType(65 + i));
+    }
+
+    CHECK(box1.size() == 10);
+    CHECK(box1.capacity() == 12);
+    CHECK(box1[9] == TestType(74));
+}
+
+TEST_CASE("push_back() self-referencing value") {
+    Container<std::string> box1 { "Alpha" };
+
+    for (int i = 0; i < 20; ++i) {
+        box1.push_back(box1[0]);
+    }
+
+    CHECK(box1.size() == 21);
+    CHECK(std::count(box1.begin(), box1.end(), "Alpha") == 21);
+}
+
+TEMPLATE_TEST_CASE("reserve()", "", char, int, double) {
+    Container<TestType> box1 { 65, 66, 67 };
+
+    box1.reserve(100);
+    CHECK(box1.capacity() == 100);
+    CHECK(box1.size() == 3);
+
+    const auto original = box1.begin();
+    for (int i = 0; i < 97; ++i) {
+        box1.push_back(TestType(68));
+    }
+    CHECK(box1.begin() == original);
+
+    // never shrinks
+    box1.reserve(10);
+    CHECK(box1.capacity() == 100);
+    CHECK(box1[0] == TestType(65));
+    CHECK(box1[2] == TestType(67));
+}
+
+TEMPLATE_TEST_CASE("shrink_to_fit()", "", char, int, double) {
+    Container<TestType> box1(64);
+
+    box1.push_back(65);
+    box1.push_back(66);
+    box1.shrink_to_fit();
+
+    CHECK(box1.capacity() == 2);
+    CHECK(box1.size() == 2);
+    CHECK(box1[0] == TestType(65));
+    CHECK(box1[1] == TestType(66));
+
+    box1.clear();
+    box1.shrink_to_fit();
+    CHECK(box1.capacity() == 0);
+    CHECK(box1.empty() == true);
+}
+
+TEST_CASE("Container(size_type) constructs no elements") {
+    {
+        Container<Tracked> box1(42);
+
+        CHECK(Tracked::live == 0);
+        CHECK(box1.capacity() == 42);
+
+        box1.emplace_back(65);
+        CHECK(Tracked::live == 1);
+    }
+    CHECK(Tracked::live == 0);
+}
+
+TEST_CASE("emplace_back()") {
+    {
+        Container<Tracked> box1{};
+
+        for (int i = 0; i < 20; ++i) {
+            CHECK(box1.emplace_back(65 + i).value == 65 + i);
+        }
+
+        CHECK(box1.size() == 20);
+        CHECK(Tracked::live == 20);
+        for (int i = 0; i < 20; ++i) {
+            CHECK(box1[i].value == 65 + i);
+        }
+    }
+    CHECK(Tracked::live == 0);
+}
+
+TEST_CASE("push_back(value_type&&)") {
+    Container<std::string> box1{};
+    std::string value(100, 'A');
+
+    box1.push_back(std::move(value));
+
+    CHECK(box1.size() == 1);
+    CHECK(box1[0] == std::string(100, 'A'));
+    CHECK(value.empty() == true);
+}
+
+TEMPLATE_TEST_CASE("pop_back()", "", char, int, double) {
+    Container<TestType> box1 { 65, 66, 67 };
+
+    box1.pop_back();
+    CHECK(box1.size() == 2);
+    CHECK(box1[1] == TestType(66));
+
+    box1.pop_back();
+    box1.pop_back();
+    CHECK(box1.empty() == true);
+    CHECK_THROWS_AS(box1.pop_back(), std::out_of_range);
+}
+
+TEMPLATE_TEST_CASE("resize()", "", char, int, double) {
+    Container<TestType> box1 { 65, 66, 67 };
+
+    box1.resize(5);
+    REQUIRE(box1.size() == 5);
+    CHECK(box1[2] == TestType(67));
+    CHECK(box1[3] == TestType{});
+    CHECK(box1[4] == TestType{});
+
+    box1.resize(8, 72);
+    REQUIRE(box1.size() == 8);
+    CHECK(box1[7] == TestType(72));
+
+    box1.resize(1);
+    CHECK(box1.size() == 1);
+    CHECK(box1[0] == TestType(65));
+}
+
+TEST_CASE("clear() and erase() destroy elements") {
+    {
+        Container<Tracked> box1{};
+
+        for (int i = 0; i < 8; ++i) {
+            box1.emplace_back(65 + i);
+        }
+
+        box1.erase(box1.begin() + 3);
+        CHECK(Tracked::live == 7);
+        CHECK(box1[3].value == 69);
+
+        box1.pop_back();
+        CHECK(Tracked::live == 6);
+
+        Container<Tracked> box2{ box1 };
+        CHECK(Tracked::live == 12);
+
+        box1.clear();
+        CHECK(Tracked::live == 6);
+        CHECK(box1.capacity() > 0);
+
+        box2 = std::move(box1);
+        CHECK(Tracked::live == 0);
+    }
+    CHECK(Tracked::live == 0);
+}
+
 TEMPLATE_TEST_CASE("erase()", "", char, int, double) {
     Container<TestType> box1 { 65, 66, 67, 68 };
 
@@ -224,6 +486,83 @@ TEMPLATE_TEST_CASE("erase()", "", char, int, double) {
     CHECK(box1.size() == 0);
 }
 
+TEMPLATE_TEST_CASE("erase(pointer, pointer)", "", char, int, double) {
+    Container<TestType> box1 { 65, 66, 67, 68, 69, 70, 71, 72 };
+
+    // delete middle range
+    auto next = box1.erase(box1.begin() + 2, box1.begin() + 5);
+    CHECK(box1 == Container<TestType>{ 65, 66, 70, 71, 72 });
+    CHECK(*next == TestType(70));
+
+    // delete empty range
+    next = box1.erase(box1.begin() + 1, box1.begin() + 1);
+    CHECK(box1.size() == 5);
+    CHECK(*next == TestType(66));
+
+    // delete tail
+    next = box1.erase(box1.begin() + 3, box1.end());
+    CHECK(box1 == Container<TestType>{ 65, 66, 70 });
+    CHECK(next == box1.end());
+
+    CHECK_THROWS_AS(box1.erase(box1.begin(), box1.end() + 1), std::out_of_range);
+    CHECK_THROWS_AS(box1.erase(box1.end(), box1.begin()), std::out_of_range);
+
+    box1.erase(box1.begin(), box1.end());
+    CHECK(box1.empty() == true);
+}
+
+TEMPLATE_TEST_CASE("erase_if()", "", char, int, double) {
+    Container<TestType> box1{};
+
+    for (int i = 0; i < 100; ++i) {
+        box1.push_back(TestType(i));
+    }
+
+    auto removed = box1.erase_if([](TestType value) { return int(value) % 3 == 0; });
+
+    CHECK(removed == 34);
+    REQUIRE(box1.size() == 66);
+    for (size_t index = 0; index < box1.size(); ++index) {
+        CHECK(int(box1[index]) % 3 != 0);
+    }
+    CHECK(std::is_sorted(box1.begin(), box1.end()) == true);
+
+    CHECK(box1.erase_if([](TestType) { return false; }) == 0);
+    CHECK(box1.erase_if([](TestType) { return true; }) == 66);
+    CHECK(box1.empty() == true);
+}
+
+TEST_CASE("erase_if() destroys removed elements") {
+    {
+        Container<Tracked> box1{};
+
+        for (int i = 0; i < 10; ++i) {
+            box1.emplace_back(i);
+        }
+
+        CHECK(box1.erase_if([](const Tracked& item) { return item.value < 5; }) == 5);
+        CHECK(Tracked::live == 5);
+        CHECK(box1[0].value == 5);
+    }
+    CHECK(Tracked::live == 0);
+}
+
+TEMPLATE_TEST_CASE("swap_erase()", "", char, int, double) {
+    Container<TestType> box1 { 65, 66, 67, 68 };
+
+    box1.swap_erase(box1.begin());
+    CHECK(box1 == Container<TestType>{ 68, 66, 67 });
+
+    box1.swap_erase(box1.end() - 1);
+    CHECK(box1 == Container<TestType>{ 68, 66 });
+
+    CHECK_THROWS_AS(box1.swap_erase(box1.end()), std::out_of_range);
+
+    box1.swap_erase(box1.begin() + 1);
+    box1.swap_erase(box1.begin());
+    CHECK(box1.empty() == true);
+}
+
 TEMPLATE_TEST_CASE("clear()", "", char, int, double) {
     const Container<TestType> REF { 65, 66, 67, 68, 69, 70, 71, 72 };
 
@@ -255,6 +594,10 @@ TEMPLATE_TEST_CASE("find(const value_type&, pointer)", "", char, int, double) {
     CHECK(box1.find(TestType{42}, box1.begin() + 1) == box1.begin() + 4);
     CHECK(box1.find(TestType{42}, box1.begin() + 5) == box1.begin() + 7);
     CHECK(box1.find(TestType{73}) == box1.end());
+
+    const Container<TestType>& box2 = box1;
+    CHECK(box2.find(TestType{42}, box2.begin() + 1) == box2.begin() + 4);
+    CHECK(box2.find(TestType{73}) == box2.end());
 }
 
 TEMPLATE_TEST_CASE("bool operator==(const Container&, const Container&)", "", char, int, double) {
@@ -302,6 +645,185 @@ TEMPLATE_TEST_CASE("Container operator+(const Container&, const Container&)", ""
     CHECK(std::equal(box3.begin(), box3.end(), REF.begin(), REF.end()) == true);
 }
 
+TEMPLATE_TEST_CASE("Container operator+ returns a Container", "", char, int, double) {
+    const Container<TestType> box1 { 65, 66 };
+    const Container<TestType> box2 { 67 };
+    const Container<TestType> box3{};
+    const Container<TestType> box4 { 68, 69, 70 };
+    const Container<TestType> REF { 65, 66, 67, 68, 69, 70 };
+
+    static_assert(std::is_same<decltype(box1 + box2), Container<TestType>>::value,
+                  "lvalue operator+ must not return an expression referring to its operands");
+
+    auto box5 = box1 + box2;
+    CHECK(box5 == Container<TestType>{ 65, 66, 67 });
+    CHECK(box5.capacity() == 3);
+    CHECK((box1 + box2 + box3 + box4) == REF);
+    CHECK(((box1 + box2) + (box3 + box4)) == REF);
+    CHECK((box1 + (box2 + box4)) == REF);
+
+    std::ostringstream output{};
+    std::ostringstream expected{};
+    output << box2 + box4;
+    expected << Container<TestType>{ 67, 68, 69, 70 };
+    CHECK(output.str() == expected.str());
+}
+
+TEMPLATE_TEST_CASE("Container concat() allocates once", "", char, int, double) {
+    const Container<TestType> box1 { 65, 66 };
+    const Container<TestType> box2 { 67 };
+    const Container<TestType> box3{};
+    const Container<TestType> box4 { 68, 69, 70 };
+    const Container<TestType> REF { 65, 66, 67, 68, 69, 70 };
+
+    const auto expression = concat(box1, box2, box3, box4);
+    CHECK(expression.size() == REF.size());
+
+    Container<TestType> box5 = expression;
+    CHECK(box5 == REF);
+    CHECK(box5.capacity() == REF.size());
+
+    Container<TestType> box6 = concat(box4);
+    CHECK(box6 == box4);
+}
+
+TEMPLATE_TEST_CASE("Container operator+ reuses expiring operands", "", char, int, double) {
+    const Container<TestType> REF { 65, 66, 67, 68, 69, 70 };
+    const Container<TestType> head { 65, 66, 67 };
+    const Container<TestType> tail { 68, 69, 70 };
+
+    Container<TestType> box1 { head };
+    box1.reserve(16);
+    const auto storage1 = box1.begin();
+    Container<TestType> box2 = std::move(box1) + tail;
+    CHECK(box2 == REF);
+    CHECK(box2.begin() == storage1);
+
+    Container<TestType> box3 { tail };
+    box3.reserve(16);
+    const auto storage3 = box3.begin();
+    Container<TestType> box4 = head + std::move(box3);
+    CHECK(box4 == REF);
+    CHECK(box4.begin() == storage3);
+
+    // no room in the expiring operand: a fresh, exact allocation
+    Container<TestType> box5 = head + Container<TestType>{ tail };
+    CHECK(box5 == REF);
+
+    Container<TestType> box6 = Container<TestType>{ head } + Container<TestType>{ tail };
+    CHECK(box6 == REF);
+
+    Container<TestType> box7 = Container<TestType>{ 65 } + (Container<TestType>{ 66 } + head);
+    CHECK(box7 == Container<TestType>{ 65, 66, 65, 66, 67 });
+
+    Container<TestType> box8 = (head + tail) + Container<TestType>{ 71 };
+    CHECK(box8 == Container<TestType>{ 65, 66, 67, 68, 69, 70, 71 });
+}
+
+TEMPLATE_TEST_CASE("Container append_range()", "", char, int, double) {
+    Container<TestType> box1 { 65, 66 };
+    const std::list<TestType> more { 67, 68, 69 };
+
+    box1.append_range(more.begin(), more.end());
+    CHECK(box1 == Container<TestType>{ 65, 66, 67, 68, 69 });
+
+    // a range within the container itself, across a reallocation
+    box1.shrink_to_fit();
+    box1.append_range(box1.begin(), box1.begin() + 2);
+    CHECK(box1 == Container<TestType>{ 65, 66, 67, 68, 69, 65, 66 });
+
+    // single-pass input
+    std::istringstream input("70 71");
+    Container<int> box2{};
+    box2.append_range(std::istream_iterator<int>(input), std::istream_iterator<int>());
+    CHECK(box2 == Container<int>{ 70, 71 });
+}
+
+TEMPLATE_TEST_CASE("Container grows trivially copyable items in place", "", char, int, double) {
+    Container<TestType> box1{};
+
+    for (int i = 0; i < 5000; ++i) {
+        box1.push_back(TestType(i % 100));
+    }
+    box1.reserve(20000);
+    box1.emplace_back(box1[1]);
+    box1.shrink_to_fit();
+
+    REQUIRE(box1.size() == 5001);
+    CHECK(box1.capacity() == 5001);
+    for (int i = 0; i < 5000; ++i) {
+        CHECK(box1[i] == TestType(i % 100));
+    }
+    CHECK(box1[5000] == TestType(1));
+
+    // a self-referencing append across a resize
+    box1.append_range(box1.begin() + 10, box1.begin() + 13);
+    CHECK(box1.size() == 5004);
+    CHECK(std::equal(box1.end() - 3, box1.end(), box1.begin() + 10));
+
+    box1.resize(5010);
+    CHECK(std::all_of(box1.end() - 6, box1.end(), [](TestType item) { return item == TestType(0); }));
+}
+
+TEST_CASE("Container<Point> copies, erases and assigns bytewise") {
+    Container<Point> box1{};
+
+    for (int i = 0; i < 10; ++i) {
+        box1.push_back(Point{ i, i * 0.5 });
+    }
+
+    Container<Point> box2 { box1 };
+    CHECK(box2 == box1);
+
+    box2.erase(box2.begin());
+    box2.erase(box2.begin() + 2, box2.begin() + 5);
+    REQUIRE(box2.size() == 6);
+    CHECK(box2[0] == Point{ 1, 0.5 });
+    CHECK(box2[2] == Point{ 6, 3.0 });
+    CHECK(box2[5] == Point{ 9, 4.5 });
+
+    box1 = box2;
+    CHECK(box1 == box2);
+    CHECK(box1.capacity() >= 10);
+}
+
+TEST_CASE("Container uses the allocator's reallocate() hook") {
+    Container<int, DoublingGrowth, ReallocAllocator<int>> box1{};
+    ReallocAllocator<int>::reallocations = 0;
+
+    for (int i = 0; i < 1000; ++i) {
+        box1.push_back(i);
+    }
+    CHECK(ReallocAllocator<int>::reallocations > 0);
+
+    box1.append_range(box1.begin(), box1.begin() + 1000);
+    REQUIRE(box1.size() == 2000);
+    for (int i = 0; i < 2000; ++i) {
+        CHECK(box1[i] == i % 1000);
+    }
+
+    // elements that are not trivially copyable never take the hook
+    Container<std::string, DoublingGrowth, ReallocAllocator<std::string>> box2{};
+    ReallocAllocator<std::string>::reallocations = 0;
+
+    for (int i = 0; i < 100; ++i) {
+        box2.push_back(std::string(30, 'A'));
+    }
+    CHECK(ReallocAllocator<std::string>::reallocations == 0);
+}
+
+TEST_CASE("Container operator+ with std::string") {
+    const Container<std::string> box1 { "Alpha", "Bravo" };
+    const Container<std::string> box2 { "Charlie" };
+
+    Container<std::string> box3 = box1 + box2 + box1;
+    CHECK(box3 == Container<std::string>{ "Alpha", "Bravo", "Charlie", "Alpha", "Bravo" });
+
+    Container<std::string> box4 = std::move(box3) + Container<std::string>{ "Delta" };
+    CHECK(box4.size() == 6);
+    CHECK(box4[5] == "Delta");
+}
+
 TEST_CASE("std::ostream& operator<<(std::ostream&, const Container<char>&)") {
     const Container<char> REF { 65, 66, 67, 68, 69, 70, 71, 72 };
 
@@ -379,6 +901,241 @@ TEST_CASE("std::ostream& operator<<(std::ostream&, const Container<std::string>&
     CHECK(output.str() == "{Alpha,Bravo,Charlie,Delta,Echo,Foxtrot,Golf}");
 }
 
+TEST_CASE("operator<< matches the stream for large containers and odd flags") {
+    Container<double> box1{};
+
+    for (int i = 0; i < 100000; ++i) {
+        box1.push_back(i * 0.37 - 1000.0);
+    }
+
+    auto stream_print = [&box1](std::ostream& output) {
+        output << '{';
+        for (auto item = box1.begin(); item != box1.end(); ++item) {
+            output << (item == box1.begin() ? "" : ",") << *item;
+        }
+        output << '}';
+    };
+
+    std::ostringstream output{};
+    std::ostringstream expected{};
+
+    SECTION("default flags") {}
+    SECTION("fixed") { output << std::fixed; expected << std::fixed; }
+    SECTION("scientific") { output << std::scientific; expected << std::scientific; }
+    SECTION("precision 12") {
+        output << std::setprecision(12);
+        expected << std::setprecision(12);
+    }
+    SECTION("showpos and uppercase fall back to the stream") {
+        output << std::showpos << std::uppercase << std::scientific;
+        expected << std::showpos << std::uppercase << std::scientific;
+    }
+
+    output << box1;
+    stream_print(expected);
+
+    CHECK(output.str() == expected.str());
+}
+
+TEMPLATE_TEST_CASE("pmr::Container allocates from its resource", "", char, int, double) {
+    alignas(std::max_align_t) unsigned char buffer[8192];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof buffer,
+                                              std::pmr::null_memory_resource());
+
+    pmr::Container<TestType> box1(&arena);
+    for (int i = 0; i < 100; ++i) {
+        box1.push_back(TestType(65 + i % 26));
+    }
+    REQUIRE(box1.size() == 100);
+    CHECK(box1.get_allocator().resource() == &arena);
+
+    const auto first = reinterpret_cast<unsigned char*>(box1.begin());
+    CHECK(first >= buffer);
+    CHECK(first < buffer + sizeof buffer);
+
+    // copies use the default resource unless they are given one
+    pmr::Container<TestType> box2(box1, &arena);
+    CHECK(box2 == box1);
+    CHECK(box2.get_allocator().resource() == &arena);
+
+    const pmr::Container<TestType> box3 { box1 };
+    CHECK(box3.get_allocator().resource() == std::pmr::get_default_resource());
+
+    // moving between resources moves the elements, not the storage
+    pmr::Container<TestType> box4{};
+    box4 = std::move(box2);
+    CHECK(box4 == box1);
+    CHECK(box4.get_allocator().resource() == std::pmr::get_default_resource());
+
+    // a concatenation takes the resource of its leftmost operand
+    pmr::Container<TestType> box5 = box1 + box3;
+    CHECK(box5.size() == 200);
+    CHECK(box5.get_allocator().resource() == &arena);
+}
+
+TEST_CASE("pmr::Container<std::pmr::string> passes its resource to the strings") {
+    alignas(std::max_align_t) unsigned char buffer[8192];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof buffer,
+                                              std::pmr::null_memory_resource());
+
+    pmr::Container<std::pmr::string> box1(&arena);
+    box1.push_back("a string far too long for the small string buffer");
+    box1.emplace_back(40, 'x');
+
+    CHECK(box1[0].get_allocator().resource() == &arena);
+    CHECK(box1[1].get_allocator().resource() == &arena);
+}
+
+TEMPLATE_TEST_CASE("save() and load() with streams", "", char, int, double) {
+    Container<TestType> box1{};
+
+    for (int i = 0; i < 1000; ++i) {
+        box1.push_back(TestType(i % 100));
+    }
+
+    std::stringstream stream{};
+    save(stream, box1);
+    save(stream, Container<TestType>{});
+
+    Container<TestType> box2 { 1, 2, 3 };
+    Container<TestType> box3 { 4 };
+    load(stream, box2);
+    load(stream, box3);
+
+    CHECK(box2 == box1);
+    CHECK(box2.capacity() == box1.size());
+    CHECK(box3.empty() == true);
+    CHECK_THROWS_AS(load(stream, box3), std::runtime_error);
+}
+
+TEMPLATE_TEST_CASE("save() and load() with buffers", "", char, int, double) {
+    const Container<TestType> REF1 { 65, 66, 67, 68, 69, 70, 71, 72 };
+    const Container<TestType> REF2 { 42 };
+
+    std::vector<char> buffer{};
+    save(buffer, REF1);
+    save(buffer, REF2);
+
+    Container<TestType> box1{};
+    Container<TestType> box2{};
+    const char* last = buffer.data() + buffer.size();
+    const char* next = load(buffer.data(), last, box1);
+    next = load(next, last, box2);
+
+    CHECK(box1 == REF1);
+    CHECK(box2 == REF2);
+    CHECK(next == last);
+}
+
+TEST_CASE("save() and load() with Container<std::string>") {
+    const Container<std::string> REF {
+        "Alpha", "", std::string(1000, 'B'), "Charlie"
+    };
+
+    std::vector<char> buffer{};
+    save(buffer, REF);
+
+    Container<std::string> box1{};
+    load(buffer.data(), buffer.data() + buffer.size(), box1);
+    CHECK(box1 == REF);
+}
+
+TEST_CASE("load() rejects malformed snapshots") {
+    const Container<int> REF { 65, 66, 67 };
+    std::vector<char> buffer{};
+    save(buffer, REF);
+
+    Container<int> box1 { 42 };
+    Container<double> box2{};
+
+    // truncated payload
+    CHECK_THROWS_AS(load(buffer.data(), buffer.data() + buffer.size() - 1, box1),
+                    std::runtime_error);
+    // wrong item type
+    CHECK_THROWS_AS(load(buffer.data(), buffer.data() + buffer.size(), box2),
+                    std::runtime_error);
+    // wrong magic
+    buffer[0] = 'X';
+    CHECK_THROWS_AS(load(buffer.data(), buffer.data() + buffer.size(), box1),
+                    std::runtime_error);
+
+    // box1 is left untouched
+    CHECK(box1 == Container<int>{ 42 });
+}
+
+TEMPLATE_TEST_CASE("load() reads large snapshots straight into the storage", "", char, int, double) {
+    Container<TestType> REF{};
+    for (int i = 0; i < 300000; ++i) {
+        REF.push_back(TestType(i % 100));
+    }
+
+    // a buffer is read into an allocation of exactly the right size
+    std::vector<char> buffer{};
+    save(buffer, REF);
+
+    Container<TestType> box1{};
+    load(buffer.data(), buffer.data() + buffer.size(), box1);
+    CHECK(box1 == REF);
+    CHECK(box1.capacity() == REF.size());
+
+    // a stream is read in batches that grow as the data arrives
+    std::stringstream stream{};
+    save(stream, REF);
+
+    Container<TestType> box2{};
+    load(stream, box2);
+    CHECK(box2 == REF);
+}
+
+TEST_CASE("load() bounds what a corrupt count allocates") {
+    std::vector<char> buffer{};
+    save(buffer, Container<int>{ 65, 66, 67 });
+
+    // claim far more items than follow
+    const std::uint64_t count = std::uint64_t(1) << 60;
+    std::memcpy(buffer.data() + offsetof(serial::Header, count), &count, sizeof count);
+
+    Container<int> box1 { 42 };
+    std::stringstream stream(std::string(buffer.begin(), buffer.end()));
+    CHECK_THROWS_AS(load(stream, box1), std::runtime_error);
+    CHECK_THROWS_AS(load(buffer.data(), buffer.data() + buffer.size(), box1),
+                    std::runtime_error);
+    CHECK(box1 == Container<int>{ 42 });
+
+    // the same goes for the length of a string
+    std::vector<char> strings{};
+    save(strings, Container<std::string>{ "Alpha" });
+    std::memcpy(strings.data() + sizeof(serial::Header), &count, sizeof count);
+
+    Container<std::string> box2{};
+    stream.clear();
+    stream.str(std::string(strings.begin(), strings.end()));
+    CHECK_THROWS_AS(load(stream, box2), std::runtime_error);
+    CHECK_THROWS_AS(load(strings.data(), strings.data() + strings.size(), box2),
+                    std::runtime_error);
+}
+
+TEST_CASE("save() and load() with Container<Tag>, which has no default ctor") {
+    Container<Tag> REF{};
+    for (int i = 0; i < 2000; ++i) {
+        REF.emplace_back(i);
+    }
+
+    std::stringstream stream{};
+    save(stream, REF);
+
+    Container<Tag> box1{};
+    load(stream, box1);
+    CHECK(box1 == REF);
+
+    std::vector<char> buffer{};
+    save(buffer, REF);
+
+    Container<Tag> box2{};
+    load(buffer.data(), buffer.data() + buffer.size(), box2);
+    CHECK(box2 == REF);
+}
+
 /* EOF */
 
 
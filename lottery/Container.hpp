@@ -4,46 +4,165 @@
 /// @note I pledge my word of honor that I have complied with the
 /// CSN Academic Integrity Policy while completing this assignment.
 /// @brief A Container stores a set of values The storage of the Container is
-/// handled automatically, being expanded as needed.
+/// handled automatically, being expanded as needed. Slots past size() are
+/// raw memory; elements are constructed in place only when they are added.
 
 #ifndef CONTAINER_HPP
 #define CONTAINER_HPP
 #include <initializer_list>
 #include <iostream>
 #include <cstdlib>
+#include <cstring>
 #include <utility>
 #include <stdexcept>
 #include <algorithm>
+#include <array>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "SimdSearch.hpp"
+#include "../common/Serialize.hpp"
+#include "../common/BufferedWriter.hpp"
+
+/// Growth policy that multiplies the capacity by Num/Den each time the
+/// Container fills, so a run of push_back calls is amortized O(1).
+template <std::size_t Num = 2, std::size_t Den = 1>
+struct GeometricGrowth {
+    static_assert(Num > Den, "geometric growth factor must be greater than 1");
+
+    /// Returns the capacity to grow to when at least required slots are needed.
+    static std::size_t next_capacity(std::size_t capacity, std::size_t required) {
+        const std::size_t grown = capacity + capacity / Den * (Num - Den)
+                                + capacity % Den * (Num - Den) / Den;
+        return std::max({grown, required, std::size_t{8}});
+    }
+};
+
+/// Doubles the capacity on every growth (the default).
+using DoublingGrowth = GeometricGrowth<2, 1>;
+
+/// Grows the capacity by half on every growth.
+using HalfAgainGrowth = GeometricGrowth<3, 2>;
+
+/// Growth policy that adds a fixed Step slots each time the Container fills.
+/// This was the original behaviour; appends cost O(n) each.
+template <std::size_t Step = 8>
+struct LinearGrowth {
+    static_assert(Step > 0, "linear growth step must be positive");
+
+    /// Returns the capacity to grow to when at least required slots are needed.
+    static std::size_t next_capacity(std::size_t capacity, std::size_t required) {
+        return std::max(capacity + Step, required);
+    }
+};
+
+namespace detail {
+
+/// Checks whether Alloc has its own construct(T*, const T&).
+template <class Alloc, class T, class = void>
+struct has_construct : std::false_type {};
+
+template <class Alloc, class T>
+struct has_construct<Alloc, T, std::void_t<decltype(std::declval<Alloc&>().construct(
+    std::declval<T*>(), std::declval<const T&>()))>> : std::true_type {};
+
+/// Checks whether Alloc offers reallocate(ptr, old_count, new_count), which
+/// resizes a block (in place if it can) and keeps its bytes.
+template <class Alloc, class T, class = void>
+struct has_reallocate : std::false_type {};
+
+template <class Alloc, class T>
+struct has_reallocate<Alloc, T, std::void_t<decltype(std::declval<Alloc&>().reallocate(
+    std::declval<T*>(), std::size_t{}, std::size_t{}))>> : std::true_type {};
+
+/// Checks whether Alloc constructs a T exactly as placement new would.
+template <class Alloc, class T>
+constexpr bool constructs_plainly_v = !has_construct<Alloc, T>::value
+                                   || std::is_same<Alloc, std::allocator<T>>::value
+                                   || std::is_same<Alloc, std::pmr::polymorphic_allocator<T>>::value;
+
+/// Returns the address a pointer, or a move_iterator over one, refers to.
+template <class P>
+P* address_of(P* it) { return it; }
+
+template <class P>
+P* address_of(std::move_iterator<P*> it) { return it.base(); }
+
+/// Checks whether It walks contiguous Ts: a pointer, or a move_iterator over one.
+template <class It, class T, class = void>
+struct is_contiguous_of : std::false_type {};
+
+template <class It, class T>
+struct is_contiguous_of<It, T, std::void_t<decltype(address_of(std::declval<It>()))>>
+: std::is_same<std::remove_cv_t<std::remove_pointer_t<decltype(address_of(std::declval<It>()))>>,
+               T> {};
+
+}  // namespace detail
 
 /// A Container that stores a set of values. The storage of the Container is
 /// handled automatically, being expanded as needed.
+/// @tparam Growth policy deciding the new capacity when the Container fills.
+/// @tparam Allocator source of the storage; elements are constructed and
+/// destroyed through it, so scoped allocators reach them too.
+template <class T, class Growth, class Allocator>
+class Container;
+
+namespace detail {
+
+template <class Source, class T, class G, class A>
+Container<T, G, A> load_container(Source& source, const A& alloc);
 
-template <class T>
+}  // namespace detail
+
+template <class T, class Growth = DoublingGrowth, class Allocator = std::allocator<T>>
 class Container {
+    using traits = std::allocator_traits<Allocator>;
+
+    static_assert(std::is_same<typename traits::value_type, T>::value,
+                  "Allocator::value_type must be T");
+    static_assert(std::is_same<typename traits::pointer, T*>::value,
+                  "Container needs an allocator with raw pointers");
+
 public:
     /// Member types.
-    using value_type    = T;
-    using size_type     = std::size_t;
-    using pointer       = value_type*;
-    using const_pointer = const value_type*;
+    using value_type     = T;
+    using allocator_type = Allocator;
+    using size_type      = std::size_t;
+    using pointer        = value_type*;
+    using const_pointer  = const value_type*;
     
-    /// Default ctor.
-    Container(size_type count = 0);
+    /// Default ctor. Reserves room for count elements without constructing any.
+    Container(size_type count = 0, const allocator_type& alloc = allocator_type());
+
+    /// Makes an empty container that allocates from alloc.
+    explicit Container(const allocator_type& alloc) : Container(0, alloc) {}
     
     /// Copy ctor.
     Container(const Container& other);
+    Container(const Container& other, const allocator_type& alloc);
 
     /// Move ctor.
     Container(Container&& other)
-    : capacity(std::exchange(other.capacity, 0)),
+    : allocated(std::exchange(other.allocated, 0)),
       used(std::exchange(other.used, 0)),
-      data(std::exchange(other.data, nullptr)) {}
+      data(std::exchange(other.data, nullptr)),
+      alloc(std::move(other.alloc)) {}
+
+    /// Move ctor using alloc. Steals the storage of other if alloc can free
+    /// it; otherwise moves the elements one by one.
+    Container(Container&& other, const allocator_type& alloc);
     
     /// Initializer List ctor
-    Container(const std::initializer_list<value_type>& init);
+    Container(const std::initializer_list<value_type>& init,
+              const allocator_type& alloc = allocator_type());
 
     /// Destructor.
-    ~Container() { delete [] data; }
+    ~Container();
     
     /// Checks if the container has no elements, e.g begin() == end()
     /// @returns true if the container is empty, false otherwise.
@@ -51,6 +170,18 @@ public:
     
     /// Returns the number of elements in the container.
     size_type size() const { return used; }
+
+    /// Returns the number of elements that can be held without reallocating.
+    size_type capacity() const { return allocated; }
+
+    /// Returns the allocator the storage comes from.
+    allocator_type get_allocator() const { return alloc; }
+
+    /// Grows the storage to hold at least new_cap elements. Never shrinks.
+    void reserve(size_type new_cap);
+
+    /// Releases unused capacity so that capacity() == size().
+    void shrink_to_fit();
     
     /// Returns a pointer to the first element.
     pointer begin() { return data; }
@@ -61,13 +192,48 @@ public:
     const_pointer end() const { return begin() + size(); }
     
     /// Adds an element to the end.
-    void push_back(const value_type& value);
+    void push_back(const value_type& value) { emplace_back(value); }
+    void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+    /// Constructs an element in place at the end from args.
+    /// @returns a reference to the new element.
+    template <class... Args>
+    T& emplace_back(Args&&... args);
+
+    /// Appends copies of the items in [first, last). Forward ranges are
+    /// measured first and grow the storage at most once; the range may
+    /// refer to elements of this container.
+    template <class InputIt>
+    void append_range(InputIt first, InputIt last);
+
+    /// Destroys the last element.
+    void pop_back();
+
+    /// Resizes the container to hold count elements. New elements are
+    /// value-initialized, or copies of value; surplus elements are destroyed.
+    void resize(size_type count);
+    void resize(size_type count, const value_type& value);
     
     /// Removes a single item from the container.
     void erase(pointer pos);
+
+    /// Removes the items in [first, last), shifting the tail down once.
+    /// @returns pointer to the element that followed the removed range.
+    pointer erase(pointer first, pointer last);
+
+    /// Removes every item for which pred returns true in a single pass,
+    /// keeping the order of the remaining items.
+    /// @returns the number of items removed.
+    template <class Predicate>
+    size_type erase_if(Predicate pred);
+
+    /// Removes a single item by moving the last item into its place.
+    /// O(1), but does not preserve the order of the items.
+    void swap_erase(pointer pos);
     
-    /// After this call, size() returns zero. The capacity remains unchanged.
-    void clear() { used = 0; }
+    /// Destroys every element. After this call, size() returns zero.
+    /// The capacity remains unchanged.
+    void clear();
 
     /// Exchanges the contents of the container with those of other.
     void swap(Container& other);
@@ -75,6 +241,7 @@ public:
     /// Finds the first element equal to the given target. Search begins at pos. 
     /// @returns pointer to the element if found, or end() if not found.
     pointer find(const value_type& target, pointer pos = nullptr);
+    const_pointer find(const value_type& target, const_pointer pos = nullptr) const;
 
     /// Replaces the contents of the container with a copy of the contents of rhs.
     Container& operator=(const Container& rhs);
@@ -98,232 +265,942 @@ public:
 
 
 private:
-    size_type capacity;  ///< Physical capacity of container.
-    size_type used;      ///< Number of items in container.
-    pointer   data;      ///< Array of items.
+    /// Elements can be copied, moved and relocated as raw bytes.
+    static constexpr bool bitwise = std::is_trivially_copyable<T>::value
+                                 && detail::constructs_plainly_v<Allocator, T>;
+
+    /// The default allocator is served by malloc, so storage can grow with realloc.
+    static constexpr bool uses_malloc = bitwise
+                                     && std::is_same<Allocator, std::allocator<T>>::value
+                                     && alignof(T) <= alignof(std::max_align_t);
+
+    /// The storage can be resized in place, by realloc or the allocator's hook.
+    static constexpr bool resizes_in_place = uses_malloc
+                                          || (bitwise && detail::has_reallocate<Allocator, T>::value);
+
+    /// Returns uninitialized storage for count elements.
+    pointer allocate(size_type count);
+
+    /// Releases storage for count elements obtained from allocate().
+    void deallocate(pointer ptr, size_type count);
+
+    /// Constructs copies of [first, last) in the raw slots starting at dest.
+    /// If a copy throws, the ones already made are destroyed.
+    /// @returns the slot following the last one constructed.
+    template <class InputIt>
+    pointer construct_from(InputIt first, InputIt last, pointer dest);
+
+    /// Constructs count elements from args in the raw slots starting at dest.
+    /// If one throws, the ones already made are destroyed.
+    template <class... Args>
+    void construct_n(pointer dest, size_type count, const Args&... args);
+
+    /// Destroys the elements in [first, last).
+    void destroy_range(pointer first, pointer last);
+
+    /// Destroys the elements in [first, end()) and shrinks used to match.
+    void destroy_from(pointer first);
+
+    /// Replaces the elements with copies of the count items in [first, last),
+    /// reusing the storage when it is large enough.
+    template <class ForwardIt>
+    void assign_range(ForwardIt first, ForwardIt last);
+
+    /// Moves the elements into an array of new_cap slots, resizing the
+    /// storage in place when resizes_in_place allows.
+    void reallocate(size_type new_cap);
+
+    /// Grows the storage and constructs a new last element from args.
+    template <class... Args>
+    T& grow_and_emplace(Args&&... args);
+
+    size_type      allocated; ///< Physical capacity of container.
+    size_type      used;      ///< Number of items in container.
+    pointer        data;      ///< Array of items.
+    allocator_type alloc;     ///< Source of the array.
+
+    /// Reads trivially copyable elements straight into the raw storage.
+    template <class Source, class U, class G, class A>
+    friend Container<U, G, A> detail::load_container(Source& source, const A& alloc);
+};
+
+namespace pmr {
+
+/// A Container whose storage comes from a std::pmr::memory_resource, e.g. a
+/// monotonic_buffer_resource released in one shot, or an unsynchronized pool.
+template <class T, class Growth = DoublingGrowth>
+using Container = ::Container<T, Growth, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+
+/// A lazy concatenation of N Containers of type Box, made by concat().
+/// Nothing is copied until it is converted to a Box, which sizes its storage
+/// for every operand, so concat(a, b, c, d) allocates exactly once.
+/// The operands are held by reference: convert the expression before any of
+/// them changes or goes out of scope.
+template <class Box, std::size_t N>
+class Concat {
+public:
+    /// Member types.
+    using value_type     = typename Box::value_type;
+    using allocator_type = typename Box::allocator_type;
+    using size_type      = std::size_t;
+
+    explicit Concat(const std::array<const Box*, N>& operands) : operands(operands) {}
+
+    /// Returns the number of elements in the concatenation.
+    size_type size() const;
+
+    /// Returns the allocator of the leftmost operand, used for the result.
+    allocator_type get_allocator() const { return operands.front()->get_allocator(); }
+
+    /// Appends every element of the concatenation, in order, to box.
+    void append_to(Box& box) const;
+
+    /// Materializes the concatenation with a single allocation.
+    operator Box() const;
+
+private:
+    std::array<const Box*, N> operands;  ///< The Containers, leftmost first.
 };
     
 // related non-member functions
     
 /// Equality comparison operator.
 /// @returns true if lhs compares equal to rhs, otherwise false
-template <class T>
-bool operator==(const Container<T>& lhs, const Container<T>& rhs);
+template <class T, class G, class A>
+bool operator==(const Container<T, G, A>& lhs, const Container<T, G, A>& rhs);
 
 /// Inequality comparison operator.
 /// @returns true if lhs does not compare equal to rhs, otherwise false
-template <class T>
-bool operator!=(const Container<T>& lhs, const Container<T>& rhs);
+template <class T, class G, class A>
+bool operator!=(const Container<T, G, A>& lhs, const Container<T, G, A>& rhs);
+
+/// Returns the concatenation of lhs and rhs, allocated once. An expiring
+/// operand lends its storage to the result.
+template <class T, class G, class A>
+Container<T, G, A> operator+(const Container<T, G, A>& lhs, const Container<T, G, A>& rhs);
+template <class T, class G, class A>
+Container<T, G, A> operator+(Container<T, G, A>&& lhs, const Container<T, G, A>& rhs);
+template <class T, class G, class A>
+Container<T, G, A> operator+(const Container<T, G, A>& lhs, Container<T, G, A>&& rhs);
+template <class T, class G, class A>
+Container<T, G, A> operator+(Container<T, G, A>&& lhs, Container<T, G, A>&& rhs);
 
-/// Returns the concatenation of lhs and rhs.
-template <class T>
-Container<T> operator+(const Container<T>& lhs, const Container<T>& rhs);
+/// Returns a lazy concatenation of first and rest, which allocates once when
+/// it is converted to a Container. It refers to its operands; see Concat.
+template <class T, class G, class A, class... Rest>
+Concat<Container<T, G, A>, 1 + sizeof...(Rest)>
+concat(const Container<T, G, A>& first, const Rest&... rest);
 
 /// Writes a formatted representation of rhs to output.
 /// @returns output
-template <class T>
-std::ostream& operator<<(std::ostream& output, const Container<T>& oset);
+template <class T, class G, class A>
+std::ostream& operator<<(std::ostream& output, const Container<T, G, A>& oset);
 
-// ============================================================================
+/// Writes a binary snapshot of box to output, or appends it to buffer.
+template <class T, class G, class A>
+void save(std::ostream& output, const Container<T, G, A>& box);
+template <class T, class G, class A>
+void save(std::vector<char>& buffer, const Container<T, G, A>& box);
+
+/// Replaces the contents of box with a snapshot read from input, or from the
+/// bytes [first, last). box is unchanged if the snapshot is malformed.
+/// @returns the first byte after the snapshot (buffer form only).
+/// @throws std::runtime_error if the snapshot is malformed or truncated.
+template <class T, class G, class A>
+void load(std::istream& input, Container<T, G, A>& box);
+template <class T, class G, class A>
+const char* load(const char* first, const char* last, Container<T, G, A>& box);
 
-template <class T>
-bool operator==(const Container<T>& lhs, const Container<T>& rhs);
+// ============================================================================
 
-template <class T>
-bool operator!=(const Container<T>& lhs, const Container<T>& rhs);
+template <class T, class G, class A>
+bool operator==(const Container<T, G, A>& lhs, const Container<T, G, A>& rhs);
 
-template <class T>
-Container<T> operator+(const Container<T>& lhs, const Container<T>& rhs);
+template <class T, class G, class A>
+bool operator!=(const Container<T, G, A>& lhs, const Container<T, G, A>& rhs);
 
-template <class T>
-std::ostream& operator<<(std::ostream& output, const Container<T>& oset);
+template <class T, class G, class A>
+std::ostream& operator<<(std::ostream& output, const Container<T, G, A>& oset);
 
-/// Default ctor.
-template <class T>
-Container<T>::Container(size_type count) {
-    data = new value_type[count];
-    used = 0;
-    capacity = count;
+/// Default ctor. Reserves room for count elements without constructing any.
+template <class T, class G, class A>
+Container<T, G, A>::Container(size_type count, const allocator_type& alloc)
+: allocated(0), used(0), data(nullptr), alloc(alloc) {
+    data = allocate(count);
+    allocated = count;
 }
 
 /// Copy ctor.
-template <class T>
-Container<T>::Container(const Container<T>& other) 
-: Container<T>(other.size()) {
-    std::copy(other.begin(), other.end(), begin());
+template <class T, class G, class A>
+Container<T, G, A>::Container(const Container& other) 
+: Container(other, traits::select_on_container_copy_construction(other.alloc)) {}
+
+/// Copy ctor using alloc.
+template <class T, class G, class A>
+Container<T, G, A>::Container(const Container& other, const allocator_type& alloc)
+: Container(other.size(), alloc) {
+    construct_from(other.begin(), other.end(), begin());
     used = other.size();
 }
 
+/// Move ctor using alloc.
+template <class T, class G, class A>
+Container<T, G, A>::Container(Container&& other, const allocator_type& alloc)
+: Container(0, alloc) {
+    if (this->alloc == other.alloc) {
+        swap(other);
+    } else {
+        reserve(other.size());
+        construct_from(std::make_move_iterator(other.begin()),
+                       std::make_move_iterator(other.end()), begin());
+        used = other.size();
+    }
+}
+
 /// Initializer List ctor
-template <class T>
-Container<T>::Container(const std::initializer_list<value_type>& init) 
-: Container<T>(init.size()) {
-    std::copy(init.begin(), init.end(), begin());
+template <class T, class G, class A>
+Container<T, G, A>::Container(const std::initializer_list<value_type>& init,
+                              const allocator_type& alloc)
+: Container(init.size(), alloc) {
+    construct_from(init.begin(), init.end(), begin());
     used = init.size();
 }
 
+/// Destructor.
+template <class T, class G, class A>
+Container<T, G, A>::~Container() {
+    destroy_range(begin(), end());
+    deallocate(data, allocated);
+}
+
 ///
-template <class T>
-T& Container<T>::at(size_type pos) {
-    if (pos > used) {
+template <class T, class G, class A>
+T& Container<T, G, A>::at(size_type pos) {
+    if (pos >= used) {
         throw std::out_of_range("Out of bounds");
     }
     return data[pos];
 }
 
 ///
-template <class T>
-const T& Container<T>::at(size_type pos) const {
-    if (pos > used) {
+template <class T, class G, class A>
+const T& Container<T, G, A>::at(size_type pos) const {
+    if (pos >= used) {
         throw std::out_of_range("Out of bounds");
     }
 
     return data[pos];
 }
 
-/// Adds an element to the end.
-template <class T>
-void Container<T>::push_back(const value_type& value) {
-    if (size() == capacity) {
-        // make a new dynamic array of sufficient size (capacity +8)
-        pointer temp = new value_type[capacity += 8];
+/// Grows the storage to hold at least new_cap elements. Never shrinks.
+template <class T, class G, class A>
+void Container<T, G, A>::reserve(size_type new_cap) {
+    if (new_cap > allocated) {
+        reallocate(new_cap);
+    }
+}
+
+/// Releases unused capacity so that capacity() == size().
+template <class T, class G, class A>
+void Container<T, G, A>::shrink_to_fit() {
+    if (used < allocated) {
+        reallocate(used);
+    }
+}
+
+/// Returns uninitialized storage for count elements.
+template <class T, class G, class A>
+typename Container<T, G, A>::pointer Container<T, G, A>::allocate(size_type count) {
+    if (count == 0) {
+        return nullptr;
+    }
+    if constexpr (uses_malloc) {
+        if (count > std::numeric_limits<size_type>::max() / sizeof(value_type)) {
+            throw std::bad_array_new_length();
+        }
+
+        void* ptr = std::malloc(count * sizeof(value_type));
+
+        if (ptr == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<pointer>(ptr);
+    } else {
+        return traits::allocate(alloc, count);
+    }
+}
+
+/// Releases storage for count elements obtained from allocate().
+template <class T, class G, class A>
+void Container<T, G, A>::deallocate(pointer ptr, size_type count) {
+    if constexpr (uses_malloc) {
+        std::free(ptr);
+    } else if (ptr != nullptr) {
+        traits::deallocate(alloc, ptr, count);
+    }
+}
+
+/// Constructs copies of [first, last) in the raw slots starting at dest.
+/// @returns the slot following the last one constructed.
+template <class T, class G, class A>
+template <class InputIt>
+typename Container<T, G, A>::pointer
+Container<T, G, A>::construct_from(InputIt first, InputIt last, pointer dest) {
+    if constexpr (bitwise && detail::is_contiguous_of<InputIt, T>::value) {
+        const auto count = last - first;
+
+        if (count > 0) {
+            std::memcpy(dest, detail::address_of(first), count * sizeof(value_type));
+        }
+        return dest + count;
+    }
+
+    pointer current = dest;
+
+    try {
+        for (; first != last; ++first, ++current) {
+            traits::construct(alloc, current, *first);
+        }
+    } catch (...) {
+        destroy_range(dest, current);
+        throw;
+    }
+    return current;
+}
+
+/// Constructs count elements from args in the raw slots starting at dest.
+template <class T, class G, class A>
+template <class... Args>
+void Container<T, G, A>::construct_n(pointer dest, size_type count, const Args&... args) {
+    if constexpr (bitwise && std::is_trivial<T>::value && sizeof...(Args) == 0) {
+        // value-initializing a trivial type zeroes it
+        std::memset(dest, 0, count * sizeof(value_type));
+        return;
+    }
+
+    pointer current = dest;
+
+    try {
+        for (; current != dest + count; ++current) {
+            traits::construct(alloc, current, args...);
+        }
+    } catch (...) {
+        destroy_range(dest, current);
+        throw;
+    }
+}
+
+/// Destroys the elements in [first, last).
+template <class T, class G, class A>
+void Container<T, G, A>::destroy_range(pointer first, pointer last) {
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+        for (; first != last; ++first) {
+            traits::destroy(alloc, first);
+        }
+    }
+}
+
+/// Destroys the elements in [first, end()) and shrinks used to match.
+template <class T, class G, class A>
+void Container<T, G, A>::destroy_from(pointer first) {
+    destroy_range(first, end());
+    used = first - begin();
+}
+
+/// Moves the elements into a new array of new_cap slots.
+template <class T, class G, class A>
+void Container<T, G, A>::reallocate(size_type new_cap) {
+    if constexpr (resizes_in_place) {
+        if (data != nullptr && new_cap != 0) {
+            // the bytes are the elements: let the block grow where it is
+            if constexpr (uses_malloc) {
+                if (new_cap > std::numeric_limits<size_type>::max() / sizeof(value_type)) {
+                    throw std::bad_array_new_length();
+                }
+
+                void* ptr = std::realloc(data, new_cap * sizeof(value_type));
+
+                if (ptr == nullptr) {
+                    throw std::bad_alloc();
+                }
+                data = static_cast<pointer>(ptr);
+            } else {
+                data = alloc.reallocate(data, allocated, new_cap);
+            }
+            allocated = new_cap;
+            return;
+        }
+    }
+
+    pointer temp = allocate(new_cap);
 
-        // copy elements from data to new temp array
-        std::copy(begin(), end(), temp);
+    try {
+        construct_from(std::make_move_iterator(begin()), std::make_move_iterator(end()), temp);
+    } catch (...) {
+        deallocate(temp, new_cap);
+        throw;
+    }
 
-        // delete the old data array
-        delete [] data;
+    destroy_range(begin(), end());
+    deallocate(data, allocated);
+    data = temp;
+    allocated = new_cap;
+}
 
-        // reassign data pointer to the temp array
-        data = temp; 
+/// Constructs an element in place at the end from args.
+/// @returns a reference to the new element.
+template <class T, class G, class A>
+template <class... Args>
+T& Container<T, G, A>::emplace_back(Args&&... args) {
+    if (size() == allocated) {
+        return grow_and_emplace(std::forward<Args>(args)...);
     }
 
-    *(data + used++) = value;
+    pointer slot = end();
+
+    traits::construct(alloc, slot, std::forward<Args>(args)...);
+    ++used;
+    return *slot;
+}
+
+/// Appends copies of the items in [first, last).
+template <class T, class G, class A>
+template <class InputIt>
+void Container<T, G, A>::append_range(InputIt first, InputIt last) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+
+    if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+        const auto count = static_cast<size_type>(std::distance(first, last));
+
+        if (size() + count <= allocated) {
+            construct_from(first, last, end());
+            used += count;
+            return;
+        }
+
+        const size_type new_cap = G::next_capacity(allocated, size() + count);
+
+        if constexpr (resizes_in_place && detail::is_contiguous_of<InputIt, T>::value) {
+            // the range may lie in the storage that is about to move
+            const auto source = detail::address_of(first);
+            const std::less<const_pointer> less{};
+
+            if (!less(source, begin()) && less(source, end())) {
+                const size_type offset = source - begin();
+
+                reallocate(new_cap);
+                std::memcpy(end(), begin() + offset, count * sizeof(value_type));
+            } else {
+                reallocate(new_cap);
+                construct_from(first, last, end());
+            }
+            used += count;
+            return;
+        }
+
+        pointer temp = allocate(new_cap);
+
+        // copy the range first: it may refer to elements of this
+        try {
+            construct_from(first, last, temp + size());
+        } catch (...) {
+            deallocate(temp, new_cap);
+            throw;
+        }
+
+        try {
+            construct_from(std::make_move_iterator(begin()), std::make_move_iterator(end()), temp);
+        } catch (...) {
+            destroy_range(temp + size(), temp + size() + count);
+            deallocate(temp, new_cap);
+            throw;
+        }
+
+        destroy_range(begin(), end());
+        deallocate(data, allocated);
+        data = temp;
+        allocated = new_cap;
+        used += count;
+    } else {
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+}
+
+/// Grows the storage and constructs a new last element from args.
+template <class T, class G, class A>
+template <class... Args>
+T& Container<T, G, A>::grow_and_emplace(Args&&... args) {
+    const size_type new_cap = G::next_capacity(allocated, size() + 1);
+
+    if constexpr (resizes_in_place) {
+        // args may refer to an element of this: build the value before resizing
+        value_type value(std::forward<Args>(args)...);
+        reallocate(new_cap);
+
+        pointer slot = end();
+
+        std::memcpy(slot, &value, sizeof(value_type));
+        ++used;
+        return *slot;
+    }
+
+    pointer temp = allocate(new_cap);
+    pointer slot = temp + size();
+
+    // construct the new element first: args may refer to an element of this
+    try {
+        traits::construct(alloc, slot, std::forward<Args>(args)...);
+    } catch (...) {
+        deallocate(temp, new_cap);
+        throw;
+    }
+
+    try {
+        construct_from(std::make_move_iterator(begin()), std::make_move_iterator(end()), temp);
+    } catch (...) {
+        traits::destroy(alloc, slot);
+        deallocate(temp, new_cap);
+        throw;
+    }
+
+    destroy_range(begin(), end());
+    deallocate(data, allocated);
+    data = temp;
+    allocated = new_cap;
+    ++used;
+    return *slot;
+}
+
+/// Destroys the last element.
+template <class T, class G, class A>
+void Container<T, G, A>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("pop_back on empty Container");
+    }
+    destroy_from(end() - 1);
+}
+
+/// Resizes the container to hold count elements, value-initializing new ones.
+template <class T, class G, class A>
+void Container<T, G, A>::resize(size_type count) {
+    if (count < size()) {
+        destroy_from(begin() + count);
+    } else if (count > size()) {
+        reserve(count);
+        construct_n(end(), count - size());
+        used = count;
+    }
+}
+
+/// Resizes the container to hold count elements, copying value into new ones.
+template <class T, class G, class A>
+void Container<T, G, A>::resize(size_type count, const value_type& value) {
+    if (count < size()) {
+        destroy_from(begin() + count);
+    } else if (count > size()) {
+        // value may live in this container, so copy it before moving storage
+        value_type copy(value);
+
+        reserve(count);
+        construct_n(end(), count - size(), copy);
+        used = count;
+    }
+}
+
+/// Destroys every element. The capacity remains unchanged.
+template <class T, class G, class A>
+void Container<T, G, A>::clear() {
+    destroy_from(begin());
 }
 
 /// Removes a single item from the container.
-template <class T>
-void Container<T>::erase(pointer pos) {
+template <class T, class G, class A>
+void Container<T, G, A>::erase(pointer pos) {
     if (pos != nullptr) {
-        if (pos < begin() || pos > end()) {
+        if (pos < begin() || pos >= end()) {
             throw std::out_of_range("Out of bounds");
         }
         // assert(pos >= begin());
         // assert(pos < end());
-        std::copy(pos + 1, end(), pos);
-        --used;
+        if constexpr (bitwise) {
+            std::memmove(pos, pos + 1, (end() - pos - 1) * sizeof(value_type));
+        } else {
+            std::move(pos + 1, end(), pos);
+        }
+        destroy_from(end() - 1);
+    }
+}
+
+/// Removes the items in [first, last), shifting the tail down once.
+/// @returns pointer to the element that followed the removed range.
+template <class T, class G, class A>
+typename Container<T, G, A>::pointer Container<T, G, A>::erase(pointer first, pointer last) {
+    if (first < begin() || last > end() || first > last) {
+        throw std::out_of_range("Out of bounds");
+    }
+    if (first != last) {
+        if constexpr (bitwise) {
+            const auto tail = end() - last;
+
+            std::memmove(first, last, tail * sizeof(value_type));
+            destroy_from(first + tail);
+        } else {
+            destroy_from(std::move(last, end(), first));
+        }
+    }
+    return first;
+}
+
+/// Removes every item for which pred returns true in a single pass.
+/// @returns the number of items removed.
+template <class T, class G, class A>
+template <class Predicate>
+typename Container<T, G, A>::size_type Container<T, G, A>::erase_if(Predicate pred) {
+    const size_type before = size();
+
+    destroy_from(std::remove_if(begin(), end(), pred));
+    return before - size();
+}
+
+/// Removes a single item by moving the last item into its place.
+template <class T, class G, class A>
+void Container<T, G, A>::swap_erase(pointer pos) {
+    if (pos < begin() || pos >= end()) {
+        throw std::out_of_range("Out of bounds");
     }
+    if (pos != end() - 1) {
+        *pos = std::move(*(end() - 1));
+    }
+    destroy_from(end() - 1);
 }
 
 /// Exchanges the contents of the container with those of other.
-template <class T>
-void Container<T>::swap(Container<T>& other) {
-    std::swap(capacity, other.capacity);
+template <class T, class G, class A>
+void Container<T, G, A>::swap(Container& other) {
+    std::swap(allocated, other.allocated);
     std::swap(used, other.used);
     std::swap(data, other.data);
+    if constexpr (traits::propagate_on_container_swap::value) {
+        std::swap(alloc, other.alloc);
+    }
 }
 
 /// Finds the first element equal to the given target. Search begins at pos. 
 /// @returns pointer to the element if found, or end() if not found.
-template <class T>
-typename Container<T>::pointer 
-Container<T>::find(const value_type& target, pointer pos) {
+template <class T, class G, class A>
+typename Container<T, G, A>::pointer 
+Container<T, G, A>::find(const value_type& target, pointer pos) {
     auto first = pos == nullptr ? begin() : pos;
-    return std::find(first, end(), target);
+
+    if constexpr (simd::is_supported_v<T>) {
+        return first + simd::find(first, end() - first, target);
+    } else {
+        return std::find(first, end(), target);
+    }
+}
+
+///
+template <class T, class G, class A>
+typename Container<T, G, A>::const_pointer
+Container<T, G, A>::find(const value_type& target, const_pointer pos) const {
+    return const_cast<Container*>(this)->find(target, const_cast<pointer>(pos));
+}
+
+/// Replaces the elements with copies of the items in [first, last).
+template <class T, class G, class A>
+template <class ForwardIt>
+void Container<T, G, A>::assign_range(ForwardIt first, ForwardIt last) {
+    const auto count = static_cast<size_type>(std::distance(first, last));
+
+    if constexpr (bitwise && detail::is_contiguous_of<ForwardIt, T>::value) {
+        if (count <= allocated) {
+            // live and raw slots alike just take the new bytes
+            if (count > 0) {
+                std::memmove(begin(), detail::address_of(first), count * sizeof(value_type));
+            }
+            used = count;
+            return;
+        }
+    }
+
+    if (count > allocated) {
+        // allocate memory to hold the new contents
+        pointer temp = allocate(count);
+
+        try {
+            construct_from(first, last, temp);
+        } catch (...) {
+            deallocate(temp, count);
+            throw;
+        }
+        clear();
+        deallocate(data, allocated);
+        data = temp;
+        allocated = count;
+    } else if (count <= size()) {
+        // assign over live elements, then destroy the surplus
+        std::copy(first, last, begin());
+        destroy_from(begin() + count);
+    } else {
+        // assign over live elements, then construct the rest in place
+        const ForwardIt middle = std::next(first, size());
+
+        std::copy(first, middle, begin());
+        construct_from(middle, last, end());
+    }
+    used = count;
 }
 
 /// Replaces the contents of the container with a copy of the contents of rhs.
-template <class T>
-Container<T>& Container<T>::operator=(const Container<T>& rhs) {
+template <class T, class G, class A>
+Container<T, G, A>& Container<T, G, A>::operator=(const Container& rhs) {
     if (this != &rhs) {
-        // deallocate any memory that Container is using internally
-        delete [] data;
-        data = nullptr;
-        used = 0;
-        // allocate memory to hold the contents of rhs
-        data = new value_type[rhs.size()];
-        used = rhs.size();
-    }
-    // copy the values from rhs into this instance
-    std::copy(rhs.begin(), rhs.begin() + rhs.size(), begin());
-    used = capacity = rhs.size();
+        if constexpr (traits::propagate_on_container_copy_assignment::value) {
+            if (alloc != rhs.alloc) {
+                // the old storage must go back to the old allocator
+                clear();
+                deallocate(data, allocated);
+                data = nullptr;
+                allocated = 0;
+            }
+            alloc = rhs.alloc;
+        }
+        assign_range(rhs.begin(), rhs.end());
+    }
 
     return *this;
 }
 
 // Move assignment operator
-template <class T>
-Container<T>& Container<T>::operator=(Container<T>&& rhs) {
+template <class T, class G, class A>
+Container<T, G, A>& Container<T, G, A>::operator=(Container&& rhs) {
+    constexpr bool steal = traits::propagate_on_container_move_assignment::value
+                        || traits::is_always_equal::value;
+
     if (this != &rhs) {
-        capacity = std::exchange(rhs.capacity, 0);
+        if constexpr (!steal) {
+            if (alloc != rhs.alloc) {
+                // our allocator cannot free rhs's storage: move the elements
+                assign_range(std::make_move_iterator(rhs.begin()),
+                             std::make_move_iterator(rhs.end()));
+                rhs.clear();
+                return *this;
+            }
+        }
+        clear();
+        deallocate(data, allocated);
+        if constexpr (traits::propagate_on_container_move_assignment::value) {
+            alloc = std::move(rhs.alloc);
+        }
+        allocated = std::exchange(rhs.allocated, 0);
         used = std::exchange(rhs.used, 0);
-        data = std::exchange(rhs.data, data);
+        data = std::exchange(rhs.data, nullptr);
     }
     return *this;
 }
 
 /// Returns other appended to this.
 /// @returns this
-template <class T>
-Container<T>& Container<T>::operator+=(const Container<T>& other) {
-    if (size() + other.size() > capacity) {
-        capacity = size() + other.size();
-        pointer temp = new value_type[capacity];
-        
-        std::copy(begin(), end(), temp);
-        
-        delete [] data;
-        data = temp;
+template <class T, class G, class A>
+Container<T, G, A>& Container<T, G, A>::operator+=(const Container& other) {
+    append_range(other.begin(), other.end());
+    return *this;
+}
+
+/// Returns the number of elements in the concatenation.
+template <class B, std::size_t N>
+typename Concat<B, N>::size_type Concat<B, N>::size() const {
+    size_type total = 0;
+
+    for (const B* operand : operands) {
+        total += operand->size();
     }
-    std::copy(other.begin(), other.end(), end());
-    used = size() + other.size();
+    return total;
+}
 
-    return *this;
+/// Appends every element of the concatenation, in order, to box.
+template <class B, std::size_t N>
+void Concat<B, N>::append_to(B& box) const {
+    for (const B* operand : operands) {
+        box.append_range(operand->begin(), operand->end());
+    }
+}
+
+/// Materializes the concatenation with a single allocation.
+template <class B, std::size_t N>
+Concat<B, N>::operator B() const {
+    B box(size(), get_allocator());
+
+    append_to(box);
+    return box;
 }
 
 // related non-member functions
             
 /// Equality comparison operator.
 /// @returns true if lhs compares equal to rhs, otherwise false
-template <class T>
-bool operator==(const Container<T>& lhs, const Container<T>& rhs) {
-    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+template <class T, class G, class A>
+bool operator==(const Container<T, G, A>& lhs, const Container<T, G, A>& rhs) {
+    if constexpr (simd::is_supported_v<T>) {
+        return lhs.size() == rhs.size() && simd::equal(lhs.begin(), rhs.begin(), lhs.size());
+    } else {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
 }
 
 /// Inequality comparison operator.
 /// @returns true if lhs does not compare equal to rhs, otherwise false
-template <class T>
-bool operator!=(const Container<T>& lhs, const Container<T>& rhs) {
-    return !std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+template <class T, class G, class A>
+bool operator!=(const Container<T, G, A>& lhs, const Container<T, G, A>& rhs) {
+    return !(lhs == rhs);
 }
 
-/// Returns the concatenation of lhs and rhs.
-template <class T>
-Container<T> operator+(const Container<T>& lhs, const Container<T>& rhs) {
-    Container<T> box(lhs);
-    
-    box += rhs;
+/// Returns the elements of lhs followed by those of rhs, in one allocation.
+template <class T, class G, class A>
+Container<T, G, A> operator+(const Container<T, G, A>& lhs, const Container<T, G, A>& rhs) {
+    Container<T, G, A> box(lhs.size() + rhs.size(), lhs.get_allocator());
+
+    box.append_range(lhs.begin(), lhs.end());
+    box.append_range(rhs.begin(), rhs.end());
     return box;
 }
 
+/// Returns lhs with rhs appended, reusing the storage of lhs.
+template <class T, class G, class A>
+Container<T, G, A> operator+(Container<T, G, A>&& lhs, const Container<T, G, A>& rhs) {
+    lhs += rhs;
+    return std::move(lhs);
+}
+
+/// Returns rhs with lhs prepended, reusing the storage of rhs if it has room.
+template <class T, class G, class A>
+Container<T, G, A> operator+(const Container<T, G, A>& lhs, Container<T, G, A>&& rhs) {
+    const auto count = lhs.size();
+
+    if (rhs.capacity() < count + rhs.size()) {
+        Container<T, G, A> box(count + rhs.size(), lhs.get_allocator());
+
+        box.append_range(lhs.begin(), lhs.end());
+        box.append_range(std::make_move_iterator(rhs.begin()),
+                         std::make_move_iterator(rhs.end()));
+        return box;
+    }
+
+    // append in place, then rotate the new elements to the front
+    rhs.append_range(lhs.begin(), lhs.end());
+    std::rotate(rhs.begin(), rhs.end() - count, rhs.end());
+    return std::move(rhs);
+}
+
+/// Returns lhs with the elements of rhs moved onto its end.
+template <class T, class G, class A>
+Container<T, G, A> operator+(Container<T, G, A>&& lhs, Container<T, G, A>&& rhs) {
+    lhs.append_range(std::make_move_iterator(rhs.begin()),
+                     std::make_move_iterator(rhs.end()));
+    return std::move(lhs);
+}
+
+/// Returns a lazy concatenation of first and rest.
+template <class T, class G, class A, class... Rest>
+Concat<Container<T, G, A>, 1 + sizeof...(Rest)>
+concat(const Container<T, G, A>& first, const Rest&... rest) {
+    static_assert(std::conjunction<std::is_same<Rest, Container<T, G, A>>...>::value,
+                  "concat() takes Containers of one type");
+
+    using Box = Container<T, G, A>;
+    constexpr std::size_t count = 1 + sizeof...(Rest);
+
+    return Concat<Box, count>(std::array<const Box*, count>{ &first, &rest... });
+}
+
 /// Writes a formatted representation of rhs to output.
 /// @returns output
-template <class T>
-std::ostream& operator<<(std::ostream& output, const Container<T>& oset) {
-    char separator[2] = "";
-
+template <class T, class G, class A>
+std::ostream& operator<<(std::ostream& output, const Container<T, G, A>& oset) {
     output << '{';
 
-    for (const typename Container<T>::value_type& item : oset) {
-        output << separator << item;
-        *separator = ',';
+    BufferedWriter writer(output);
+
+    for (auto item = oset.begin(); item != oset.end(); ++item) {
+        if (item != oset.begin()) {
+            writer.put(',');
+        }
+        writer.write(*item);
     }
 
-    output << '}';
+    writer.put('}');
 
     return output;
 }
 
+namespace detail {
+
+/// Writes box to sink: the header, then every item.
+template <class Sink, class T, class G, class A>
+void save_container(Sink& sink, const Container<T, G, A>& box) {
+    serial::write_header<T>(sink, "CTNR", box.size());
+    serial::write_items(sink, box.begin(), box.end());
+}
+
+/// Reads a Container from source. Trivially copyable items are read straight
+/// into the storage past end(): from a buffer, which is checked against the
+/// header, in one read; from a stream, in batches that double in size.
+template <class Source, class T, class G, class A>
+Container<T, G, A> load_container(Source& source, const A& alloc) {
+    const auto count = serial::read_header<T>(source, "CTNR");
+    Container<T, G, A> box(alloc);
+
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        while (box.used < count) {
+            const auto batch = serial::next_batch(source, count, box.used, sizeof(T));
+
+            box.reserve(box.used + batch);
+            source.read(box.end(), batch * sizeof(T));
+            box.used += batch;
+        }
+    } else {
+        box.reserve(source.reservable(count, sizeof(T)));
+        serial::read_items<T>(source, count, std::back_inserter(box));
+    }
+    return box;
+}
+
+}  // namespace detail
+
+/// Writes a binary snapshot of box to output.
+template <class T, class G, class A>
+void save(std::ostream& output, const Container<T, G, A>& box) {
+    serial::StreamSink sink(output);
+    detail::save_container(sink, box);
+}
+
+/// Appends a binary snapshot of box to buffer.
+template <class T, class G, class A>
+void save(std::vector<char>& buffer, const Container<T, G, A>& box) {
+    serial::BufferSink sink(buffer);
+    detail::save_container(sink, box);
+}
+
+/// Replaces the contents of box with a snapshot read from input.
+template <class T, class G, class A>
+void load(std::istream& input, Container<T, G, A>& box) {
+    serial::StreamSource source(input);
+    box = detail::load_container<serial::StreamSource, T, G>(source, box.get_allocator());
+}
+
+/// Replaces the contents of box with the snapshot at the start of [first, last).
+/// @returns the first byte after the snapshot.
+template <class T, class G, class A>
+const char* load(const char* first, const char* last, Container<T, G, A>& box) {
+    serial::BufferSource source(first, last);
+    box = detail::load_container<serial::BufferSource, T, G>(source, box.get_allocator());
+    return source.position();
+}
+
 #endif /* CONTAINER_HPP */
 
 /* EOF */
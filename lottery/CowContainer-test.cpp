@@ -0,0 +1,166 @@
+/// @file CowContainer-test.cpp
+/// @brief Catch2 Unit tests for the copy-on-write CowContainer
+
+#define CATCH_CONFIG_MAIN
+#if defined __linux__
+#include <catch.hpp>
+#elif defined __MACH__
+#include </opt/local/include/catch2/catch.hpp>
+#else
+#include "catch.hpp"
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <initializer_list>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "CowContainer.hpp"
+#include "CowContainer.hpp"  // check include guard
+
+TEMPLATE_TEST_CASE("CowContainer()", "", char, int, double) {
+    const CowContainer<TestType> box1{};
+
+    CHECK(box1.size() == 0);
+    CHECK(box1.empty() == true);
+    CHECK(box1.is_shared() == false);
+    CHECK(box1.begin() == box1.end());
+    CHECK(box1.find(TestType(65)) == box1.end());
+    CHECK_THROWS_AS(box1.at(0), std::out_of_range);
+}
+
+TEMPLATE_TEST_CASE("CowContainer copies share the contents", "", char, int, double) {
+    const CowContainer<TestType> box1 { 65, 66, 67, 68, 69 };
+    CowContainer<TestType> box2 { box1 };
+    CowContainer<TestType> box3{};
+
+    box3 = box2;
+
+    CHECK(box2 == box1);
+    CHECK(box2.begin() == box1.begin());
+    CHECK(box3.begin() == box1.begin());
+    CHECK(box1.is_shared() == true);
+    CHECK(box3[4] == TestType(69));
+    CHECK(box3.at(4) == TestType(69));
+    CHECK(box3.find(TestType(67)) == box3.begin() + 2);
+}
+
+TEMPLATE_TEST_CASE("CowContainer copies on first write", "", char, int, double) {
+    const CowContainer<TestType> REF { 65, 66, 67, 68, 69 };
+    CowContainer<TestType> box1 { REF };
+
+    box1.push_back(TestType(70));
+
+    CHECK(REF == CowContainer<TestType>{ 65, 66, 67, 68, 69 });
+    CHECK(box1 == CowContainer<TestType>{ 65, 66, 67, 68, 69, 70 });
+    CHECK(box1.begin() != REF.begin());
+    CHECK(box1.is_shared() == false);
+    CHECK(REF.is_shared() == false);
+
+    // unique contents are modified in place
+    const TestType* first = box1.begin();
+    box1.erase(box1.begin() + 1);
+    box1.pop_back();
+    CHECK(box1.begin() == first);
+    CHECK(box1 == CowContainer<TestType>{ 65, 67, 68, 69 });
+
+    CowContainer<TestType> box2 { REF };
+    box2.erase(box2.begin());
+    CHECK(box2 == CowContainer<TestType>{ 66, 67, 68, 69 });
+    CHECK(REF.size() == 5);
+    CHECK_THROWS_AS(box2.erase(REF.begin()), std::out_of_range);
+
+    CowContainer<TestType> box3 { REF };
+    box3.edit()[0] = TestType(90);
+    CHECK(box3[0] == TestType(90));
+    CHECK(REF[0] == TestType(65));
+
+    CowContainer<TestType> box4 { REF };
+    box4.clear();
+    CHECK(box4.empty() == true);
+    CHECK(REF.size() == 5);
+}
+
+TEMPLATE_TEST_CASE("CowContainer operator+=", "", char, int, double) {
+    const CowContainer<TestType> REF { 65, 66 };
+    CowContainer<TestType> box1{};
+
+    box1 += REF;
+    CHECK(box1.begin() == REF.begin());
+
+    box1 += REF;
+    CHECK(box1 == CowContainer<TestType>{ 65, 66, 65, 66 });
+    CHECK(REF.size() == 2);
+
+    box1 += box1;
+    CHECK(box1 == CowContainer<TestType>{ 65, 66, 65, 66, 65, 66, 65, 66 });
+}
+
+TEMPLATE_TEST_CASE("CowContainer move", "", char, int, double) {
+    CowContainer<TestType> box1 { 65, 66, 67 };
+    const TestType* first = box1.begin();
+
+    CowContainer<TestType> box2 { std::move(box1) };
+    CHECK(box2.begin() == first);
+    CHECK(box1.empty() == true);
+
+    box1 = std::move(box2);
+    CHECK(box1.begin() == first);
+
+    CowContainer<TestType> box3 { Container<TestType>{ 68, 69 } };
+    CHECK(box3 == CowContainer<TestType>{ 68, 69 });
+}
+
+TEST_CASE("CowContainer snapshots shared across threads") {
+    Container<long> values{};
+    for (long i = 0; i < 10000; ++i) {
+        values.push_back(i);
+    }
+
+    CowContainer<long> writer { std::move(values) };
+    std::atomic<int> bad{0};
+    std::vector<std::thread> readers{};
+
+    for (int id = 0; id < 4; ++id) {
+        readers.emplace_back([snapshot = writer, &bad] {
+            for (int round = 0; round < 20; ++round) {
+                CowContainer<long> local { snapshot };
+
+                if (std::accumulate(local.begin(), local.end(), 0L) != 49995000L) {
+                    ++bad;
+                }
+            }
+        });
+    }
+
+    // the writer detaches from the readers' snapshot, which stays intact
+    for (long i = 0; i < 100; ++i) {
+        writer.push_back(i);
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    CHECK(bad.load() == 0);
+    CHECK(writer.size() == 10100);
+    CHECK(writer.is_shared() == false);
+}
+
+TEST_CASE("CowContainer<std::string>") {
+    const CowContainer<std::string> REF { "Alpha", "Bravo" };
+    CowContainer<std::string> box1 { REF };
+
+    box1.emplace_back(box1[0]);
+    CHECK(box1 == CowContainer<std::string>{ "Alpha", "Bravo", "Alpha" });
+    CHECK(REF.size() == 2);
+
+    std::ostringstream output{};
+    output << REF;
+    CHECK(output.str() == "{Alpha,Bravo}");
+}
+
+/* EOF */
@@ -0,0 +1,303 @@
+/// @file CowContainer.hpp
+/// @author Brandon Timok <8000477724@student.csn.edu>
+/// @date 03/14/2022
+/// @brief A CowContainer is a snapshot of a Container that copies in O(1).
+/// Copies share one buffer until one of them is modified, and only then is
+/// the buffer deep-copied (copy-on-write).
+
+#ifndef COW_CONTAINER_HPP
+#define COW_CONTAINER_HPP
+#include <initializer_list>
+#include <iostream>
+#include <cstdlib>
+#include <cstddef>
+#include <atomic>
+#include <utility>
+#include <stdexcept>
+
+#include "Container.hpp"
+
+/// A copy-on-write handle to a Container.
+///
+/// Copying a CowContainer only bumps an atomic reference count, so the same
+/// large contents can be handed to many readers, on any thread. Every
+/// mutating member first makes the contents unique to this handle: if other
+/// handles still share them, they are deep-copied, and the others keep the
+/// old version. Reads never copy.
+///
+/// Distinct handles may be used from different threads at once, even when
+/// they share contents. A single handle is no more thread-safe than a
+/// Container.
+template <class T, class Growth = DoublingGrowth>
+class CowContainer {
+public:
+    /// Member types.
+    using container_type = Container<T, Growth>;
+    using value_type     = T;
+    using size_type      = std::size_t;
+    using const_pointer  = const value_type*;
+
+    /// Default ctor. Allocates nothing.
+    CowContainer() = default;
+
+    /// Takes over the contents of box.
+    explicit CowContainer(container_type box) : shared(new Shared(std::move(box))) {}
+
+    /// Initializer List ctor
+    CowContainer(const std::initializer_list<value_type>& init) : shared(new Shared(init)) {}
+
+    /// Copy ctor. Shares the contents of other: O(1).
+    CowContainer(const CowContainer& other) noexcept : shared(other.shared) { retain(); }
+
+    /// Move ctor. other is left empty.
+    CowContainer(CowContainer&& other) noexcept : shared(std::exchange(other.shared, nullptr)) {}
+
+    /// Destructor. The contents are freed with the last handle sharing them.
+    ~CowContainer() { release(); }
+
+    /// Shares the contents of rhs: O(1).
+    CowContainer& operator=(const CowContainer& rhs) noexcept;
+
+    /// Moves the contents of the container instead of replacing.
+    CowContainer& operator=(CowContainer&& rhs) noexcept;
+
+    /// Checks if the container has no elements.
+    bool empty() const { return size() == 0; }
+
+    /// Returns the number of elements in the container.
+    size_type size() const { return shared == nullptr ? 0 : shared->box.size(); }
+
+    /// Checks whether other handles share the contents of this one.
+    bool is_shared() const { return shared != nullptr && shared->refs.load(std::memory_order_acquire) > 1; }
+
+    /// Returns the contents, read-only.
+    const container_type& view() const;
+
+    /// Returns the contents for modification, copying them first if they are
+    /// shared. The reference is valid until this handle is copied from,
+    /// assigned to or destroyed.
+    container_type& edit();
+
+    /// Returns a pointer to the first element.
+    const_pointer begin() const { return view().begin(); }
+
+    /// Returns a pointer to the end (the element following the last element).
+    const_pointer end() const { return view().end(); }
+
+    /// Adds an element to the end.
+    void push_back(const value_type& value) { emplace_back(value); }
+    void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+    /// Constructs an element in place at the end from args.
+    /// @returns a reference to the new element.
+    template <class... Args>
+    T& emplace_back(Args&&... args);
+
+    /// Removes the last element.
+    void pop_back() { edit().pop_back(); }
+
+    /// Removes a single item from the container.
+    /// @throws std::out_of_range if pos is not an element of the container.
+    void erase(const_pointer pos);
+
+    /// Removes every element.
+    void clear();
+
+    /// Grows the storage to hold at least new_cap elements.
+    void reserve(size_type new_cap) { edit().reserve(new_cap); }
+
+    /// Exchanges the contents of the container with those of other.
+    void swap(CowContainer& other) noexcept { std::swap(shared, other.shared); }
+
+    /// Finds the first element equal to the given target.
+    /// @returns pointer to the element if found, or end() if not found.
+    const_pointer find(const value_type& target) const { return view().find(target); }
+
+    /// Appends other to this.
+    /// @returns this
+    CowContainer& operator+=(const CowContainer& other);
+
+    /// Returns the value at the index chosen.
+    /// Checks for out of bounds.
+    const T& at(size_type pos) const { return view().at(pos); }
+
+    /// Returns the value at the index chosen.
+    /// Does not check for bounds.
+    const T& operator[](size_type pos) const { return view()[pos]; }
+
+private:
+    /// The contents, and the number of handles sharing them.
+    struct Shared {
+        template <class... Args>
+        explicit Shared(Args&&... args) : box(std::forward<Args>(args)...) {}
+
+        std::atomic<size_type> refs{1};
+        container_type         box;
+    };
+
+    /// Counts one more handle sharing the contents.
+    void retain() noexcept;
+
+    /// Drops this handle's share, freeing the contents if it was the last.
+    void release() noexcept;
+
+    Shared* shared = nullptr; ///< Shared contents; nullptr when never filled.
+};
+
+// related non-member functions
+
+/// Equality comparison operator.
+/// @returns true if lhs compares equal to rhs, otherwise false
+template <class T, class G>
+bool operator==(const CowContainer<T, G>& lhs, const CowContainer<T, G>& rhs);
+
+/// Inequality comparison operator.
+/// @returns true if lhs does not compare equal to rhs, otherwise false
+template <class T, class G>
+bool operator!=(const CowContainer<T, G>& lhs, const CowContainer<T, G>& rhs);
+
+/// Writes a formatted representation of rhs to output.
+/// @returns output
+template <class T, class G>
+std::ostream& operator<<(std::ostream& output, const CowContainer<T, G>& oset);
+
+// ============================================================================
+
+/// Shares the contents of rhs: O(1).
+template <class T, class G>
+CowContainer<T, G>& CowContainer<T, G>::operator=(const CowContainer& rhs) noexcept {
+    if (shared != rhs.shared) {
+        CowContainer copy(rhs);
+        swap(copy);
+    }
+    return *this;
+}
+
+/// Moves the contents of the container instead of replacing.
+template <class T, class G>
+CowContainer<T, G>& CowContainer<T, G>::operator=(CowContainer&& rhs) noexcept {
+    if (this != &rhs) {
+        CowContainer dead(std::move(rhs));
+        swap(dead);
+    }
+    return *this;
+}
+
+/// Counts one more handle sharing the contents.
+template <class T, class G>
+void CowContainer<T, G>::retain() noexcept {
+    if (shared != nullptr) {
+        // the new handle is made from an existing one, which keeps the
+        // contents alive meanwhile, so no ordering is needed
+        shared->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/// Drops this handle's share, freeing the contents if it was the last.
+template <class T, class G>
+void CowContainer<T, G>::release() noexcept {
+    // release: our reads of the contents happen before whoever frees or
+    // modifies them next; acquire: the one who does sees all of them
+    if (shared != nullptr && shared->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        delete shared;
+    }
+    shared = nullptr;
+}
+
+/// Returns the contents, read-only.
+template <class T, class G>
+const typename CowContainer<T, G>::container_type& CowContainer<T, G>::view() const {
+    static const container_type nothing{};
+    return shared == nullptr ? nothing : shared->box;
+}
+
+/// Returns the contents for modification, copying them first if they are shared.
+template <class T, class G>
+typename CowContainer<T, G>::container_type& CowContainer<T, G>::edit() {
+    if (shared == nullptr) {
+        shared = new Shared();
+    } else if (shared->refs.load(std::memory_order_acquire) != 1) {
+        // other handles keep the old contents; this one gets its own copy
+        Shared* copy = new Shared(shared->box);
+
+        release();
+        shared = copy;
+    }
+    return shared->box;
+}
+
+/// Constructs an element in place at the end from args.
+/// @returns a reference to the new element.
+template <class T, class G>
+template <class... Args>
+T& CowContainer<T, G>::emplace_back(Args&&... args) {
+    // args may refer to the shared contents, which edit() leaves in place
+    return edit().emplace_back(std::forward<Args>(args)...);
+}
+
+/// Removes a single item from the container.
+template <class T, class G>
+void CowContainer<T, G>::erase(const_pointer pos) {
+    if (pos < begin() || pos >= end()) {
+        throw std::out_of_range("Out of bounds");
+    }
+
+    // pos points into the contents as they are now: find it again after edit()
+    const size_type index = pos - begin();
+    container_type& box = edit();
+
+    box.erase(box.begin() + index);
+}
+
+/// Removes every element.
+template <class T, class G>
+void CowContainer<T, G>::clear() {
+    if (is_shared()) {
+        // nothing to copy: just stop sharing
+        release();
+    } else if (shared != nullptr) {
+        shared->box.clear();
+    }
+}
+
+/// Appends other to this.
+/// @returns this
+template <class T, class G>
+CowContainer<T, G>& CowContainer<T, G>::operator+=(const CowContainer& other) {
+    if (empty()) {
+        *this = other;
+    } else if (!other.empty()) {
+        // hold other's contents: other may be this, and edit() may drop them
+        const CowContainer keep(other);
+
+        edit() += keep.view();
+    }
+    return *this;
+}
+
+// related non-member functions
+
+/// Equality comparison operator.
+/// @returns true if lhs compares equal to rhs, otherwise false
+template <class T, class G>
+bool operator==(const CowContainer<T, G>& lhs, const CowContainer<T, G>& rhs) {
+    return lhs.view() == rhs.view();
+}
+
+/// Inequality comparison operator.
+/// @returns true if lhs does not compare equal to rhs, otherwise false
+template <class T, class G>
+bool operator!=(const CowContainer<T, G>& lhs, const CowContainer<T, G>& rhs) {
+    return !(lhs == rhs);
+}
+
+/// Writes a formatted representation of rhs to output.
+/// @returns output
+template <class T, class G>
+std::ostream& operator<<(std::ostream& output, const CowContainer<T, G>& oset) {
+    return output << oset.view();
+}
+
+#endif /* COW_CONTAINER_HPP */
+
+/* EOF */
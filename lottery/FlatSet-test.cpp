@@ -0,0 +1,131 @@
+/// @file FlatSet-test.cpp
+/// @brief Catch2 Unit tests for the sorted FlatSet
+
+#define CATCH_CONFIG_MAIN
+#if defined __linux__
+#include <catch.hpp>
+#elif defined __MACH__
+#include </opt/local/include/catch2/catch.hpp>
+#else
+#include "catch.hpp"
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <set>
+#include <sstream>
+#include <string>
+
+#include "FlatSet.hpp"
+#include "FlatSet.hpp"  // check include guard
+
+TEMPLATE_TEST_CASE("FlatSet()", "", char, int, double) {
+    FlatSet<TestType> set1{};
+
+    CHECK(set1.size() == 0);
+    CHECK(set1.empty() == true);
+    CHECK(set1.begin() == set1.end());
+    CHECK(set1.contains(TestType(65)) == false);
+}
+
+TEMPLATE_TEST_CASE("FlatSet(initializer_list)", "", char, int, double) {
+    const FlatSet<TestType> set1 { 70, 65, 68, 65, 66, 70 };
+    const TestType EXPECTED[] = { 65, 66, 68, 70 };
+
+    REQUIRE(set1.size() == 4);
+    CHECK(std::equal(set1.begin(), set1.end(), std::begin(EXPECTED), std::end(EXPECTED)));
+}
+
+TEMPLATE_TEST_CASE("FlatSet insert()", "", char, int, double) {
+    FlatSet<TestType> set1{};
+
+    auto result = set1.insert(TestType(67));
+    CHECK(result.second == true);
+    CHECK(*result.first == TestType(67));
+
+    set1.insert(TestType(65));
+    set1.insert(TestType(69));
+    result = set1.insert(TestType(66));
+    CHECK(result.second == true);
+    CHECK(result.first == set1.begin() + 1);
+
+    result = set1.insert(TestType(67));
+    CHECK(result.second == false);
+    CHECK(result.first == set1.begin() + 2);
+
+    CHECK(set1 == FlatSet<TestType>{ 65, 66, 67, 69 });
+}
+
+TEMPLATE_TEST_CASE("FlatSet contains() and lower_bound()", "", char, int, double) {
+    const FlatSet<TestType> set1 { 10, 20, 30, 40 };
+
+    CHECK(set1.contains(TestType(10)) == true);
+    CHECK(set1.contains(TestType(40)) == true);
+    CHECK(set1.contains(TestType(25)) == false);
+    CHECK(set1.contains(TestType(5)) == false);
+    CHECK(set1.contains(TestType(45)) == false);
+
+    CHECK(set1.lower_bound(TestType(5)) == set1.begin());
+    CHECK(set1.lower_bound(TestType(20)) == set1.begin() + 1);
+    CHECK(set1.lower_bound(TestType(25)) == set1.begin() + 2);
+    CHECK(set1.lower_bound(TestType(45)) == set1.end());
+}
+
+TEMPLATE_TEST_CASE("FlatSet insert_range()", "", char, int, double) {
+    FlatSet<TestType> set1 { 20, 40, 60 };
+    const TestType BATCH[] = { 70, 10, 40, 50, 10, 20 };
+
+    set1.insert_range(std::begin(BATCH), std::end(BATCH));
+
+    CHECK(set1 == FlatSet<TestType>{ 10, 20, 40, 50, 60, 70 });
+
+    set1.insert_range(std::begin(BATCH), std::begin(BATCH));
+    CHECK(set1.size() == 6);
+}
+
+TEMPLATE_TEST_CASE("FlatSet erase()", "", char, int, double) {
+    FlatSet<TestType> set1 { 65, 66, 67 };
+
+    CHECK(set1.erase(TestType(66)) == true);
+    CHECK(set1.erase(TestType(66)) == false);
+    CHECK(set1 == FlatSet<TestType>{ 65, 67 });
+
+    set1.clear();
+    CHECK(set1.empty() == true);
+}
+
+TEST_CASE("FlatSet<int, EytzingerLayout> agrees with std::set") {
+    for (int count : { 0, 1, 2, 3, 7, 8, 15, 16, 100, 1000 }) {
+        FlatSet<int, EytzingerLayout> set1{};
+        std::set<int> ref{};
+
+        for (int i = 0; i < count; ++i) {
+            const int value = std::rand() % (2 * count + 1);
+
+            set1.insert(value);
+            ref.insert(value);
+        }
+
+        REQUIRE(set1.size() == ref.size());
+        CHECK(std::equal(set1.begin(), set1.end(), ref.begin(), ref.end()));
+
+        for (int value = -1; value <= 2 * count + 1; ++value) {
+            CHECK(set1.contains(value) == (ref.count(value) == 1));
+        }
+    }
+}
+
+TEST_CASE("FlatSet<std::string> with a custom order") {
+    FlatSet<std::string, EytzingerLayout, std::greater<std::string>> set1 {
+        "Alpha", "Charlie", "Bravo", "Alpha"
+    };
+    std::ostringstream output{};
+
+    output << set1;
+
+    CHECK(output.str() == "{Charlie,Bravo,Alpha}");
+    CHECK(set1.contains("Bravo") == true);
+    CHECK(set1.contains("Delta") == false);
+}
+
+/* EOF */
@@ -0,0 +1,311 @@
+/// @file FlatSet.hpp
+/// @author Brandon Timok <8000477724@student.csn.edu>
+/// @date 03/14/2022
+/// @brief A FlatSet stores a sorted set of unique values in a single
+/// Container, giving O(log n) lookups with no per-element allocation.
+
+#ifndef FLAT_SET_HPP
+#define FLAT_SET_HPP
+#include <initializer_list>
+#include <iostream>
+#include <cstdlib>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+#include "Container.hpp"
+
+/// Layout tag: look values up by binary search over the sorted storage.
+struct SortedLayout {};
+
+/// Layout tag: also keep a copy of the values in Eytzinger (breadth-first)
+/// order and look them up with a branch-free descent. Every mutation
+/// rebuilds the copy in O(n), so use it for read-mostly sets.
+struct EytzingerLayout {};
+
+/// A sorted set of unique values stored contiguously in a Container.
+/// @tparam Layout SortedLayout or EytzingerLayout, used by contains().
+template <class T, class Layout = SortedLayout, class Compare = std::less<T>>
+class FlatSet {
+public:
+    /// Member types.
+    using value_type    = T;
+    using size_type     = std::size_t;
+    using const_pointer = const value_type*;
+
+    /// Default ctor.
+    FlatSet() = default;
+
+    /// Initializer List ctor. Duplicates are dropped.
+    FlatSet(const std::initializer_list<value_type>& init);
+
+    /// Checks if the set has no elements.
+    bool empty() const { return items.empty(); }
+
+    /// Returns the number of elements in the set.
+    size_type size() const { return items.size(); }
+
+    /// Returns a pointer to the smallest element.
+    const_pointer begin() const { return items.begin(); }
+
+    /// Returns a pointer to the end (the element following the largest element).
+    const_pointer end() const { return items.end(); }
+
+    /// Returns the value at the index chosen, in sorted order.
+    const T& operator[](size_type pos) const { return items[pos]; }
+
+    /// Inserts value unless an equal element is already present.
+    /// @returns pointer to the element equal to value, and true if it was inserted.
+    std::pair<const_pointer, bool> insert(const value_type& value);
+
+    /// Inserts every value in [first, last) with a single merge pass.
+    /// The batch does not need to be sorted or unique.
+    template <class InputIt>
+    void insert_range(InputIt first, InputIt last);
+
+    /// Removes the element equal to value, if any.
+    /// @returns true if an element was removed.
+    bool erase(const value_type& value);
+
+    /// Removes every element.
+    void clear();
+
+    /// Checks whether an element equal to value is present.
+    bool contains(const value_type& value) const;
+
+    /// Finds the first element that is not less than value.
+    /// @returns pointer to the element, or end() if there is none.
+    const_pointer lower_bound(const value_type& value) const;
+
+private:
+    /// Rebuilds the Eytzinger copy of items. Does nothing for SortedLayout.
+    void rebuild_index();
+
+    /// Returns the position in the Eytzinger copy of the first element not
+    /// less than value, or index.size() if there is none.
+    size_type eytzinger_search(const value_type& value) const;
+
+    Container<value_type> items{};  ///< Sorted, unique values.
+    Container<value_type> index{};  ///< items in breadth-first order (EytzingerLayout only).
+    Compare               compare{}; ///< Strict weak ordering of the values.
+};
+
+// related non-member functions
+
+/// Equality comparison operator.
+/// @returns true if lhs and rhs hold the same values, otherwise false
+template <class T, class L, class C>
+bool operator==(const FlatSet<T, L, C>& lhs, const FlatSet<T, L, C>& rhs);
+
+/// Inequality comparison operator.
+/// @returns true if lhs and rhs hold different values, otherwise false
+template <class T, class L, class C>
+bool operator!=(const FlatSet<T, L, C>& lhs, const FlatSet<T, L, C>& rhs);
+
+/// Writes a formatted representation of rhs to output.
+/// @returns output
+template <class T, class L, class C>
+std::ostream& operator<<(std::ostream& output, const FlatSet<T, L, C>& oset);
+
+// ============================================================================
+
+/// Initializer List ctor. Duplicates are dropped.
+template <class T, class L, class C>
+FlatSet<T, L, C>::FlatSet(const std::initializer_list<value_type>& init) {
+    insert_range(init.begin(), init.end());
+}
+
+/// Inserts value unless an equal element is already present.
+/// @returns pointer to the element equal to value, and true if it was inserted.
+template <class T, class L, class C>
+std::pair<typename FlatSet<T, L, C>::const_pointer, bool>
+FlatSet<T, L, C>::insert(const value_type& value) {
+    const_pointer pos = lower_bound(value);
+
+    if (pos != end() && !compare(value, *pos)) {
+        return { pos, false };
+    }
+
+    // append, then rotate the new element down into its sorted slot
+    const size_type offset = pos - begin();
+
+    items.push_back(value);
+    std::rotate(items.begin() + offset, items.end() - 1, items.end());
+    rebuild_index();
+
+    return { begin() + offset, true };
+}
+
+/// Inserts every value in [first, last) with a single merge pass.
+template <class T, class L, class C>
+template <class InputIt>
+void FlatSet<T, L, C>::insert_range(InputIt first, InputIt last) {
+    Container<value_type> batch{};
+
+    for (; first != last; ++first) {
+        batch.push_back(*first);
+    }
+    if (batch.empty()) {
+        return;
+    }
+    if (!std::is_sorted(batch.begin(), batch.end(), compare)) {
+        std::sort(batch.begin(), batch.end(), compare);
+    }
+
+    Container<value_type> merged(items.size() + batch.size());
+    auto lhs = items.begin();
+    auto rhs = batch.begin();
+
+    // classic two-way merge that keeps one copy of each equivalent value
+    while (lhs != items.end() || rhs != batch.end()) {
+        const bool take_rhs = lhs == items.end()
+                           || (rhs != batch.end() && compare(*rhs, *lhs));
+        auto& next = take_rhs ? *rhs : *lhs;
+
+        if (merged.empty() || compare(*(merged.end() - 1), next)) {
+            merged.push_back(std::move(next));
+        }
+        if (take_rhs) {
+            ++rhs;
+        } else {
+            ++lhs;
+        }
+    }
+
+    items = std::move(merged);
+    rebuild_index();
+}
+
+/// Removes the element equal to value, if any.
+/// @returns true if an element was removed.
+template <class T, class L, class C>
+bool FlatSet<T, L, C>::erase(const value_type& value) {
+    const_pointer pos = lower_bound(value);
+
+    if (pos == end() || compare(value, *pos)) {
+        return false;
+    }
+    items.erase(items.begin() + (pos - begin()));
+    rebuild_index();
+    return true;
+}
+
+/// Removes every element.
+template <class T, class L, class C>
+void FlatSet<T, L, C>::clear() {
+    items.clear();
+    index.clear();
+}
+
+/// Checks whether an element equal to value is present.
+template <class T, class L, class C>
+bool FlatSet<T, L, C>::contains(const value_type& value) const {
+    if constexpr (std::is_same<L, EytzingerLayout>::value) {
+        const size_type pos = eytzinger_search(value);
+        return pos != index.size() && !compare(value, index[pos]);
+    } else {
+        const_pointer pos = lower_bound(value);
+        return pos != end() && !compare(value, *pos);
+    }
+}
+
+/// Finds the first element that is not less than value.
+/// @returns pointer to the element, or end() if there is none.
+template <class T, class L, class C>
+typename FlatSet<T, L, C>::const_pointer
+FlatSet<T, L, C>::lower_bound(const value_type& value) const {
+    return std::lower_bound(begin(), end(), value, compare);
+}
+
+/// Rebuilds the Eytzinger copy of items. Does nothing for SortedLayout.
+template <class T, class L, class C>
+void FlatSet<T, L, C>::rebuild_index() {
+    if constexpr (std::is_same<L, EytzingerLayout>::value) {
+        const size_type count = items.size();
+        Container<size_type> order{};
+        size_type next = 0;
+
+        // an in-order walk of the implicit tree (children of k are 2k+1 and
+        // 2k+2) visits its slots in sorted order
+        order.resize(count);
+        auto walk = [&](auto& self, size_type k) -> void {
+            if (k < count) {
+                self(self, 2 * k + 1);
+                order[k] = next++;
+                self(self, 2 * k + 2);
+            }
+        };
+        walk(walk, 0);
+
+        index.clear();
+        index.reserve(count);
+        for (size_type k = 0; k < count; ++k) {
+            index.push_back(items[order[k]]);
+        }
+    }
+}
+
+/// Returns the position in the Eytzinger copy of the first element not
+/// less than value, or index.size() if there is none.
+template <class T, class L, class C>
+typename FlatSet<T, L, C>::size_type
+FlatSet<T, L, C>::eytzinger_search(const value_type& value) const {
+    const size_type count = index.size();
+    const_pointer tree = index.begin();
+    size_type k = 1;  // 1-based slot, so the children of k are 2k and 2k+1
+
+    while (k <= count) {
+#if defined __GNUC__ || defined __clang__
+        // the 16th descendant is 4 levels down; fetch it while we compare
+        __builtin_prefetch(tree + std::min(16 * k, count) - 1);
+#endif
+        k = 2 * k + compare(tree[k - 1], value);
+    }
+
+    // undo the right turns taken after the last left turn, then that turn
+    while (k & 1) {
+        k >>= 1;
+    }
+    k >>= 1;
+    return k == 0 ? count : k - 1;
+}
+
+// related non-member functions
+
+/// Equality comparison operator.
+/// @returns true if lhs and rhs hold the same values, otherwise false
+template <class T, class L, class C>
+bool operator==(const FlatSet<T, L, C>& lhs, const FlatSet<T, L, C>& rhs) {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+/// Inequality comparison operator.
+/// @returns true if lhs and rhs hold different values, otherwise false
+template <class T, class L, class C>
+bool operator!=(const FlatSet<T, L, C>& lhs, const FlatSet<T, L, C>& rhs) {
+    return !(lhs == rhs);
+}
+
+/// Writes a formatted representation of rhs to output.
+/// @returns output
+template <class T, class L, class C>
+std::ostream& operator<<(std::ostream& output, const FlatSet<T, L, C>& oset) {
+    char separator[2] = "";
+
+    output << '{';
+
+    for (const auto& item : oset) {
+        output << separator << item;
+        *separator = ',';
+    }
+
+    output << '}';
+
+    return output;
+}
+
+#endif /* FLAT_SET_HPP */
+
+/* EOF */
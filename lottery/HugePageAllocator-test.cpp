@@ -0,0 +1,120 @@
+/// @file HugePageAllocator-test.cpp
+/// @brief Catch2 Unit tests for the huge-page HugePageAllocator and HugeContainer
+
+#define CATCH_CONFIG_MAIN
+#if defined __linux__
+#include <catch.hpp>
+#elif defined __MACH__
+#include </opt/local/include/catch2/catch.hpp>
+#else
+#include "catch.hpp"
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <sstream>
+
+#include "HugePageAllocator.hpp"
+#include "HugePageAllocator.hpp"  // check include guard
+
+namespace {
+/// A small threshold so the tests cross it without gigabytes of memory.
+constexpr std::size_t THRESHOLD = std::size_t{1} << 16;
+
+template <class T>
+using SmallThreshold = HugePageAllocator<T, THRESHOLD>;
+}  // namespace
+
+TEMPLATE_TEST_CASE("HugePageAllocator allocate() and deallocate()", "", char, int, double) {
+    SmallThreshold<TestType> alloc{};
+    const std::size_t small = 16;
+    const std::size_t large = THRESHOLD / sizeof(TestType) * 4;
+
+    TestType* ptr1 = alloc.allocate(small);
+    std::fill(ptr1, ptr1 + small, TestType(65));
+    CHECK(std::count(ptr1, ptr1 + small, TestType(65)) == 16);
+    alloc.deallocate(ptr1, small);
+
+    TestType* ptr2 = alloc.allocate(large);
+    std::fill(ptr2, ptr2 + large, TestType(66));
+    CHECK(std::count(ptr2, ptr2 + large, TestType(66)) == static_cast<std::ptrdiff_t>(large));
+#if defined __linux__
+    CHECK(SmallThreshold<TestType>::is_mapped(large));
+    CHECK(reinterpret_cast<std::uintptr_t>(ptr2) % SmallThreshold<TestType>::huge_page == 0);
+#endif
+    alloc.deallocate(ptr2, large);
+}
+
+TEMPLATE_TEST_CASE("HugePageAllocator reallocate() keeps the contents", "", char, int, double) {
+    SmallThreshold<TestType> alloc{};
+    const std::size_t sizes[] = {
+        8, 100,                                    // heap to heap
+        THRESHOLD / sizeof(TestType) * 2,          // heap to mapping
+        THRESHOLD / sizeof(TestType) * 64,         // mapping to mapping
+        THRESHOLD / sizeof(TestType) * 3,          // mapping shrinks
+        50                                         // mapping to heap
+    };
+
+    std::size_t count = sizes[0];
+    TestType* ptr = alloc.allocate(count);
+    for (std::size_t pos = 0; pos < count; ++pos) {
+        ptr[pos] = TestType(pos % 100);
+    }
+
+    for (std::size_t next : sizes) {
+        ptr = alloc.reallocate(ptr, count, next);
+        for (std::size_t pos = count; pos < next; ++pos) {
+            ptr[pos] = TestType(pos % 100);
+        }
+        count = next;
+
+        bool intact = true;
+        for (std::size_t pos = 0; pos < count; ++pos) {
+            intact = intact && ptr[pos] == TestType(pos % 100);
+        }
+        CHECK(intact);
+    }
+    alloc.deallocate(ptr, count);
+}
+
+TEMPLATE_TEST_CASE("HugeContainer grows across the threshold", "", char, int, double) {
+    HugeContainer<TestType, DoublingGrowth, THRESHOLD> box1{};
+    const std::size_t count = THRESHOLD / sizeof(TestType) * 16;
+
+    for (std::size_t pos = 0; pos < count; ++pos) {
+        box1.push_back(TestType(pos % 100));
+    }
+    box1 += box1;
+
+    REQUIRE(box1.size() == 2 * count);
+    bool intact = true;
+    for (std::size_t pos = 0; pos < box1.size(); ++pos) {
+        intact = intact && box1[pos] == TestType(pos % count % 100);
+    }
+    CHECK(intact);
+
+    HugeContainer<TestType, DoublingGrowth, THRESHOLD> box2 { box1 };
+    CHECK(box2 == box1);
+
+    box2.erase(box2.begin() + 10, box2.end());
+    box2.shrink_to_fit();
+    CHECK(box2.capacity() == 10);
+    CHECK(box2[9] == TestType(9));
+}
+
+TEST_CASE("HugeContainer with the default threshold") {
+    HugeContainer<int> box1{};
+
+    for (int i = 0; i < 1 << 20; ++i) {
+        box1.push_back(i);
+    }
+    CHECK(box1.size() == std::size_t{1} << 20);
+    CHECK(std::accumulate(box1.begin(), box1.end(), 0LL) == (1LL << 19) * ((1LL << 20) - 1));
+
+    std::ostringstream output{};
+    output << HugeContainer<int>{ 65, 66, 67 };
+    CHECK(output.str() == "{65,66,67}");
+}
+
+/* EOF */
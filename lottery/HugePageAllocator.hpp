@@ -0,0 +1,219 @@
+/// @file HugePageAllocator.hpp
+/// @author Brandon Timok <8000477724@student.csn.edu>
+/// @date 03/14/2022
+/// @brief A HugePageAllocator serves large blocks from anonymous memory maps
+/// backed by transparent huge pages, and grows them with mremap so that no
+/// bytes are copied. Small blocks come from the normal heap.
+
+#ifndef HUGE_PAGE_ALLOCATOR_HPP
+#define HUGE_PAGE_ALLOCATOR_HPP
+#include <cstdlib>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <limits>
+#include <new>
+
+#if defined __linux__
+#include <sys/mman.h>
+#endif
+
+#include "Container.hpp"
+
+/// An allocator for multi-gigabyte arrays of trivially copyable values.
+///
+/// Blocks of at least Threshold bytes are mapped anonymously, aligned to a
+/// huge page and advised with MADV_HUGEPAGE, so scans miss the TLB far less.
+/// reallocate() resizes such a block with mremap(MREMAP_MAYMOVE): the kernel
+/// moves page table entries instead of copying bytes, which is what Container
+/// uses to grow trivially copyable contents. Smaller blocks, and every block
+/// on systems other than Linux, come from malloc and realloc.
+template <class T, std::size_t Threshold = std::size_t{1} << 21>
+class HugePageAllocator {
+public:
+    /// Member types.
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    /// Lets allocator_traits rebind past the non-type parameter.
+    template <class U>
+    struct rebind {
+        using other = HugePageAllocator<U, Threshold>;
+    };
+
+    /// Size and alignment of a transparent huge page.
+    static constexpr size_type huge_page = size_type{1} << 21;
+
+    HugePageAllocator() = default;
+
+    template <class U>
+    HugePageAllocator(const HugePageAllocator<U, Threshold>&) noexcept {}
+
+    /// Returns uninitialized storage for count elements.
+    /// @throws std::bad_alloc if no memory is available.
+    T* allocate(size_type count);
+
+    /// Releases storage returned for count elements.
+    void deallocate(T* ptr, size_type count) noexcept;
+
+    /// Resizes the storage at ptr from old_count to new_count elements and
+    /// keeps the bytes of the first min(old_count, new_count). Large blocks
+    /// grow in place or are remapped; nothing is copied unless the block
+    /// crosses the threshold.
+    /// @returns the new address of the storage.
+    /// @throws std::bad_alloc if no memory is available; ptr is then untouched.
+    T* reallocate(T* ptr, size_type old_count, size_type new_count);
+
+    /// Checks whether a block of count elements is memory mapped.
+    static bool is_mapped(size_type count) {
+#if defined __linux__
+        return count >= (Threshold + sizeof(T) - 1) / sizeof(T);
+#else
+        return false;
+#endif
+    }
+
+    friend bool operator==(const HugePageAllocator&, const HugePageAllocator&) { return true; }
+    friend bool operator!=(const HugePageAllocator&, const HugePageAllocator&) { return false; }
+
+private:
+    /// Returns the size in bytes of count elements.
+    /// @throws std::bad_array_new_length on overflow.
+    static size_type bytes(size_type count);
+
+    /// Returns the length of the mapping for count elements: whole huge pages.
+    static size_type mapped_length(size_type count) {
+        return (bytes(count) + huge_page - 1) & ~(huge_page - 1);
+    }
+
+    /// Maps length bytes aligned to a huge page.
+    static void* map(size_type length);
+};
+
+/// A Container whose storage lives in huge pages once it reaches Threshold
+/// bytes, growing with mremap instead of copying.
+template <class T, class Growth = DoublingGrowth, std::size_t Threshold = std::size_t{1} << 21>
+using HugeContainer = Container<T, Growth, HugePageAllocator<T, Threshold>>;
+
+// ============================================================================
+
+/// Returns the size in bytes of count elements.
+template <class T, std::size_t N>
+typename HugePageAllocator<T, N>::size_type HugePageAllocator<T, N>::bytes(size_type count) {
+    if (count > std::numeric_limits<size_type>::max() / sizeof(T) - huge_page) {
+        throw std::bad_array_new_length();
+    }
+    return count * sizeof(T);
+}
+
+/// Maps length bytes aligned to a huge page.
+template <class T, std::size_t N>
+void* HugePageAllocator<T, N>::map(size_type length) {
+#if defined __linux__
+    // map a huge page extra, then trim the ends so the block starts aligned
+    const size_type padded = length + huge_page;
+    void* mapping = ::mmap(nullptr, padded, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (mapping == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+
+    const auto base  = reinterpret_cast<std::uintptr_t>(mapping);
+    const auto start = (base + huge_page - 1) & ~std::uintptr_t{huge_page - 1};
+    const size_type head = start - base;
+
+    if (head != 0) {
+        ::munmap(mapping, head);
+    }
+    ::munmap(reinterpret_cast<void*>(start + length), padded - head - length);
+
+#if defined MADV_HUGEPAGE
+    // only advice: without transparent huge pages the block still works
+    ::madvise(reinterpret_cast<void*>(start), length, MADV_HUGEPAGE);
+#endif
+    return reinterpret_cast<void*>(start);
+#else
+    (void)length;
+    throw std::bad_alloc();
+#endif
+}
+
+/// Returns uninitialized storage for count elements.
+template <class T, std::size_t N>
+T* HugePageAllocator<T, N>::allocate(size_type count) {
+    if (is_mapped(count)) {
+        return static_cast<T*>(map(mapped_length(count)));
+    }
+
+    void* ptr = std::malloc(std::max<size_type>(bytes(count), 1));
+
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return static_cast<T*>(ptr);
+}
+
+/// Releases storage returned for count elements.
+template <class T, std::size_t N>
+void HugePageAllocator<T, N>::deallocate(T* ptr, size_type count) noexcept {
+#if defined __linux__
+    if (is_mapped(count)) {
+        ::munmap(ptr, mapped_length(count));
+        return;
+    }
+#endif
+    std::free(ptr);
+}
+
+/// Resizes the storage at ptr from old_count to new_count elements.
+/// @returns the new address of the storage.
+template <class T, std::size_t N>
+T* HugePageAllocator<T, N>::reallocate(T* ptr, size_type old_count, size_type new_count) {
+    const bool was_mapped = is_mapped(old_count);
+    const bool now_mapped = is_mapped(new_count);
+
+#if defined __linux__
+    if (was_mapped && now_mapped) {
+        const size_type old_length = mapped_length(old_count);
+        const size_type new_length = mapped_length(new_count);
+
+        if (new_length == old_length) {
+            return ptr;
+        }
+
+        void* mapping = ::mremap(ptr, old_length, new_length, MREMAP_MAYMOVE);
+
+        if (mapping == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+#if defined MADV_HUGEPAGE
+        if (new_length > old_length) {
+            ::madvise(mapping, new_length, MADV_HUGEPAGE);
+        }
+#endif
+        return static_cast<T*>(mapping);
+    }
+#endif
+
+    if (!was_mapped && !now_mapped) {
+        void* resized = std::realloc(ptr, std::max<size_type>(bytes(new_count), 1));
+
+        if (resized == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(resized);
+    }
+
+    // crossing the threshold: the block changes kind, so copy once
+    T* fresh = allocate(new_count);
+
+    std::memcpy(static_cast<void*>(fresh), ptr, bytes(std::min(old_count, new_count)));
+    deallocate(ptr, old_count);
+    return fresh;
+}
+
+#endif /* HUGE_PAGE_ALLOCATOR_HPP */
+
+/* EOF */
@@ -0,0 +1,191 @@
+/// @file IncrementalContainer-test.cpp
+/// @brief Catch2 Unit tests for the incrementally growing IncrementalContainer
+
+#define CATCH_CONFIG_MAIN
+#if defined __linux__
+#include <catch.hpp>
+#elif defined __MACH__
+#include </opt/local/include/catch2/catch.hpp>
+#else
+#include "catch.hpp"
+#endif
+
+#include <algorithm>
+#include <initializer_list>
+#include <sstream>
+#include <string>
+
+#include "IncrementalContainer.hpp"
+#include "IncrementalContainer.hpp"  // check include guard
+
+TEMPLATE_TEST_CASE("IncrementalContainer()", "", char, int, double) {
+    IncrementalContainer<TestType> box1{};
+
+    CHECK(box1.size() == 0);
+    CHECK(box1.empty() == true);
+    CHECK(box1.capacity() == 0);
+    CHECK(box1.migrating() == false);
+    CHECK(box1.begin() == box1.end());
+}
+
+TEMPLATE_TEST_CASE("IncrementalContainer(initializer_list)", "", char, int, double) {
+    const IncrementalContainer<TestType> box1 { 65, 66, 67, 68, 69, 70, 71, 72, 73, 74 };
+    const TestType EXPECTED[] = { 65, 66, 67, 68, 69, 70, 71, 72, 73, 74 };
+
+    REQUIRE(box1.size() == 10);
+    CHECK(box1.capacity() == 10);
+    CHECK(box1.migrating() == false);
+    CHECK(std::equal(box1.begin(), box1.end(), std::begin(EXPECTED), std::end(EXPECTED)));
+}
+
+TEMPLATE_TEST_CASE("IncrementalContainer push_back() migrates a few elements at a time", "", char, int, double) {
+    IncrementalContainer<TestType, 2> box1{};
+
+    for (int i = 0; i < 16; ++i) {
+        box1.push_back(TestType(i));
+    }
+    // the migration from the first array ended before the second filled up
+    CHECK(box1.capacity() == 16);
+    CHECK(box1.migrating() == false);
+
+    // the 17th element starts a new array; 16 elements wait in the old one
+    box1.push_back(TestType(16));
+    CHECK(box1.capacity() == 32);
+    CHECK(box1.migrating() == true);
+
+    for (int pos = 0; pos < 17; ++pos) {
+        CHECK(box1[pos] == TestType(pos));
+        CHECK(box1.at(pos) == TestType(pos));
+    }
+    CHECK_THROWS_AS(box1.at(17), std::out_of_range);
+
+    // 2 per push: 7 more pushes finish the migration
+    for (int i = 17; i < 24; ++i) {
+        box1.push_back(TestType(i));
+    }
+    CHECK(box1.migrating() == false);
+    for (int pos = 0; pos < 24; ++pos) {
+        CHECK(box1[pos] == TestType(pos));
+    }
+}
+
+TEMPLATE_TEST_CASE("IncrementalContainer keeps every value across many growths", "", char, int, double) {
+    IncrementalContainer<TestType> box1{};
+
+    for (int i = 0; i < 5000; ++i) {
+        box1.push_back(TestType(i % 100));
+        CHECK(box1[i / 2] == TestType(i / 2 % 100));
+    }
+
+    REQUIRE(box1.size() == 5000);
+    for (int i = 0; i < 5000; ++i) {
+        CHECK(box1[i] == TestType(i % 100));
+    }
+}
+
+TEMPLATE_TEST_CASE("IncrementalContainer find() and iterators during migration", "", char, int, double) {
+    IncrementalContainer<TestType, 1> box1{};
+
+    for (int i = 0; i < 40; ++i) {
+        box1.push_back(TestType(i + 40));
+    }
+    REQUIRE(box1.migrating() == true);
+
+    CHECK(box1.find(TestType(40)) == box1.begin());
+    CHECK(box1.find(TestType(70)) == box1.begin() + 30);
+    CHECK(box1.find(TestType(79)) == box1.begin() + 39);
+    CHECK(box1.find(TestType(80)) == box1.end());
+    CHECK(box1.end() - box1.begin() == 40);
+
+    std::sort(box1.begin(), box1.end(), [](TestType lhs, TestType rhs) { return lhs > rhs; });
+    CHECK(box1[0] == TestType(79));
+    CHECK(box1[39] == TestType(40));
+
+    typename IncrementalContainer<TestType, 1>::const_iterator first = box1.begin();
+    CHECK(*first == TestType(79));
+}
+
+TEMPLATE_TEST_CASE("IncrementalContainer pop_back(), reserve() and shrink_to_fit()", "", char, int, double) {
+    IncrementalContainer<TestType, 1> box1{};
+
+    for (int i = 0; i < 20; ++i) {
+        box1.push_back(TestType(i));
+    }
+    REQUIRE(box1.migrating() == true);
+
+    // popping elements that still sit in the old array
+    while (box1.size() > 10) {
+        box1.pop_back();
+    }
+    CHECK(box1.migrating() == false);
+    CHECK(box1[9] == TestType(9));
+
+    box1.reserve(100);
+    CHECK(box1.capacity() == 100);
+    CHECK(box1.migrating() == true);
+    box1.finish_migration();
+    CHECK(box1.migrating() == false);
+
+    box1.shrink_to_fit();
+    CHECK(box1.capacity() == 10);
+    CHECK(box1 == IncrementalContainer<TestType, 1>{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 });
+
+    box1.clear();
+    CHECK(box1.empty() == true);
+    CHECK_THROWS_AS(box1.pop_back(), std::out_of_range);
+}
+
+TEMPLATE_TEST_CASE("IncrementalContainer copy and move", "", char, int, double) {
+    IncrementalContainer<TestType, 1> box1{};
+
+    for (int i = 0; i < 12; ++i) {
+        box1.push_back(TestType(i + 65));
+    }
+    REQUIRE(box1.migrating() == true);
+
+    IncrementalContainer<TestType, 1> box2 { box1 };
+    CHECK(box2 == box1);
+    CHECK(box2.migrating() == false);
+
+    IncrementalContainer<TestType, 1> box3 { std::move(box1) };
+    CHECK(box3 == box2);
+    CHECK(box3.migrating() == true);
+    CHECK(box1.empty() == true);
+
+    box1 = box3;
+    CHECK(box1 == box3);
+    box1.push_back(TestType(42));
+    CHECK(box1 != box3);
+
+    box3 = std::move(box1);
+    CHECK(box3.size() == 13);
+}
+
+TEST_CASE("IncrementalContainer<std::string>") {
+    IncrementalContainer<std::string, 1> box1{};
+
+    for (int i = 0; i < 100; ++i) {
+        box1.emplace_back(40, static_cast<char>('A' + i % 26));
+    }
+
+    // fill an exact reserve() so the next push grows mid-migration, and
+    // append an element that still sits in the old array
+    box1.finish_migration();
+    box1.shrink_to_fit();
+    box1.reserve(101);
+    box1.push_back("x");
+    REQUIRE(box1.migrating() == true);
+    REQUIRE(box1.size() == box1.capacity());
+
+    box1.push_back(box1[50]);
+    CHECK(box1.size() == 102);
+    CHECK(box1[101] == std::string(40, 'Y'));
+    CHECK(box1[100] == "x");
+    CHECK(box1[50] == std::string(40, 'Y'));
+
+    std::ostringstream output{};
+    output << IncrementalContainer<std::string>{ "Alpha", "Bravo" };
+    CHECK(output.str() == "{Alpha,Bravo}");
+}
+
+/* EOF */
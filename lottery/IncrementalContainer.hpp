@@ -0,0 +1,520 @@
+/// @file IncrementalContainer.hpp
+/// @author Brandon Timok <8000477724@student.csn.edu>
+/// @date 03/14/2022
+/// @brief An IncrementalContainer grows without a stop-the-world copy: the
+/// old array is kept beside the new one and its elements move over a few at
+/// a time, so no single push_back pays for the whole reallocation.
+
+#ifndef INCREMENTAL_CONTAINER_HPP
+#define INCREMENTAL_CONTAINER_HPP
+#include <initializer_list>
+#include <iostream>
+#include <cstdlib>
+#include <cstddef>
+#include <utility>
+#include <stdexcept>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include "../common/BufferedWriter.hpp"
+
+/// A Container whose reallocation is spread over later operations.
+///
+/// When the array is full, a new one of twice the capacity is allocated and
+/// the new element goes straight into it. The existing elements stay in the
+/// old array; every later push_back or pop_back moves the next Step of them
+/// across. While that migration runs, indices in [migrated, old_used) are
+/// read from the old array and every other index from the new one.
+///
+/// Since the capacity doubles and Step is at least 1, the migration always
+/// ends before the new array fills up, so push_back costs O(Step) in the
+/// worst case rather than only amortized.
+template <class T, std::size_t Step = 4>
+class IncrementalContainer {
+    static_assert(Step > 0, "IncrementalContainer must migrate at least one element per operation");
+
+    template <bool Const>
+    class Iterator;
+
+public:
+    /// Member types.
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using pointer         = value_type*;
+    using const_pointer   = const value_type*;
+    using iterator        = Iterator<false>;
+    using const_iterator  = Iterator<true>;
+
+    /// Default ctor. Allocates nothing.
+    IncrementalContainer() = default;
+
+    /// Copy ctor. The copy is compact: nothing is left to migrate.
+    IncrementalContainer(const IncrementalContainer& other);
+
+    /// Move ctor. Takes over the arrays of other, which is left empty.
+    IncrementalContainer(IncrementalContainer&& other) noexcept { swap(other); }
+
+    /// Initializer List ctor
+    IncrementalContainer(const std::initializer_list<value_type>& init);
+
+    /// Destructor.
+    ~IncrementalContainer();
+
+    /// Replaces the contents of the container with a copy of the contents of rhs.
+    IncrementalContainer& operator=(const IncrementalContainer& rhs);
+
+    /// Moves the contents of the container instead of replacing.
+    IncrementalContainer& operator=(IncrementalContainer&& rhs) noexcept;
+
+    /// Checks if the container has no elements.
+    bool empty() const { return used == 0; }
+
+    /// Returns the number of elements in the container.
+    size_type size() const { return used; }
+
+    /// Returns the number of elements the current array can hold.
+    size_type capacity() const { return allocated; }
+
+    /// Checks whether elements are still waiting in the old array.
+    bool migrating() const { return old_data != nullptr; }
+
+    /// Moves every element still in the old array and releases it, e.g.
+    /// before a phase where latency does not matter.
+    void finish_migration() { migrate(old_used); }
+
+    /// Grows the array to hold at least new_cap elements. The elements move
+    /// over incrementally, as after an ordinary growth. Never shrinks.
+    void reserve(size_type new_cap);
+
+    /// Reallocates the array so that capacity() == size(). This moves every
+    /// element at once.
+    void shrink_to_fit();
+
+    /// Returns an iterator to the first element.
+    iterator begin() { return { this, 0 }; }
+    const_iterator begin() const { return { this, 0 }; }
+
+    /// Returns an iterator to the end (the element following the last element).
+    iterator end() { return { this, used }; }
+    const_iterator end() const { return { this, used }; }
+
+    /// Adds an element to the end and migrates up to Step old elements.
+    void push_back(const value_type& value) { emplace_back(value); }
+    void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+    /// Constructs an element in place at the end from args, then migrates
+    /// up to Step old elements.
+    /// @returns a reference to the new element.
+    template <class... Args>
+    T& emplace_back(Args&&... args);
+
+    /// Destroys the last element, then migrates up to Step old elements.
+    void pop_back();
+
+    /// Destroys every element. The current array is kept for reuse.
+    void clear();
+
+    /// Exchanges the contents of the container with those of other.
+    void swap(IncrementalContainer& other) noexcept;
+
+    /// Finds the first element equal to the given target.
+    /// @returns iterator to the element if found, or end() if not found.
+    iterator find(const value_type& target);
+    const_iterator find(const value_type& target) const;
+
+    /// Returns the value at the index chosen.
+    /// Checks for out of bounds.
+    T& at(size_type pos);
+    const T& at(size_type pos) const;
+
+    /// Returns the value at the index chosen, from whichever array holds it.
+    /// Does not check for bounds.
+    T& operator[](size_type pos) { return *slot(pos); }
+    const T& operator[](size_type pos) const { return *slot(pos); }
+
+private:
+    /// Returns the address of the element at pos in whichever array holds it.
+    pointer slot(size_type pos) const {
+        return pos >= migrated && pos < old_used ? old_data + pos : data + pos;
+    }
+
+    /// Starts migrating into a new array of new_cap slots.
+    void grow(size_type new_cap);
+
+    /// Moves up to count elements from the old array, and releases the old
+    /// array once it is empty.
+    void migrate(size_type count);
+
+    /// Releases the old array, which must hold no elements.
+    void release_old();
+
+    /// Destroys the elements in [first, last).
+    static void destroy(pointer first, pointer last);
+
+    pointer   data = nullptr;     ///< The current array.
+    size_type allocated = 0;      ///< Size of the current array.
+    size_type used = 0;           ///< Number of items in container.
+    pointer   old_data = nullptr; ///< The array being migrated from, if any.
+    size_type old_allocated = 0;  ///< Size of the old array.
+    size_type old_used = 0;       ///< Indices below this were in the old array.
+    size_type migrated = 0;       ///< Indices below this have moved across.
+};
+
+/// Random access iterator over an IncrementalContainer. It holds an index,
+/// so it stays valid across growth and migration.
+template <class T, std::size_t Step>
+template <bool Const>
+class IncrementalContainer<T, Step>::Iterator {
+    using owner_type = std::conditional_t<Const, const IncrementalContainer, IncrementalContainer>;
+
+public:
+    // member types
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = std::conditional_t<Const, const T*, T*>;
+    using reference         = std::conditional_t<Const, const T&, T&>;
+
+    Iterator() = default;
+    Iterator(owner_type* owner, size_type pos) : owner(owner), pos(pos) {}
+
+    /// A mutable iterator converts to a const one.
+    template <bool C = Const, class = std::enable_if_t<!C>>
+    operator Iterator<true>() const { return { owner, pos }; }
+
+    reference operator*() const { return (*owner)[pos]; }
+    pointer operator->() const { return &(*owner)[pos]; }
+    reference operator[](difference_type n) const { return (*owner)[pos + n]; }
+
+    Iterator& operator++() { ++pos; return *this; }
+    Iterator operator++(int) { Iterator tmp = *this; ++pos; return tmp; }
+    Iterator& operator--() { --pos; return *this; }
+    Iterator operator--(int) { Iterator tmp = *this; --pos; return tmp; }
+
+    Iterator& operator+=(difference_type n) { pos += n; return *this; }
+    Iterator& operator-=(difference_type n) { pos -= n; return *this; }
+
+    friend Iterator operator+(Iterator itr, difference_type n) { return itr += n; }
+    friend Iterator operator+(difference_type n, Iterator itr) { return itr += n; }
+    friend Iterator operator-(Iterator itr, difference_type n) { return itr -= n; }
+
+    friend difference_type operator-(const Iterator& lhs, const Iterator& rhs) {
+        return static_cast<difference_type>(lhs.pos) - static_cast<difference_type>(rhs.pos);
+    }
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) { return lhs.pos == rhs.pos; }
+    friend bool operator!=(const Iterator& lhs, const Iterator& rhs) { return lhs.pos != rhs.pos; }
+    friend bool operator<(const Iterator& lhs, const Iterator& rhs) { return lhs.pos < rhs.pos; }
+    friend bool operator>(const Iterator& lhs, const Iterator& rhs) { return lhs.pos > rhs.pos; }
+    friend bool operator<=(const Iterator& lhs, const Iterator& rhs) { return lhs.pos <= rhs.pos; }
+    friend bool operator>=(const Iterator& lhs, const Iterator& rhs) { return lhs.pos >= rhs.pos; }
+
+private:
+    owner_type* owner = nullptr; ///< Container iterated over.
+    size_type   pos = 0;         ///< Index of the element referred to.
+};
+
+// related non-member functions
+
+/// Equality comparison operator.
+/// @returns true if lhs compares equal to rhs, otherwise false
+template <class T, std::size_t S>
+bool operator==(const IncrementalContainer<T, S>& lhs, const IncrementalContainer<T, S>& rhs);
+
+/// Inequality comparison operator.
+/// @returns true if lhs does not compare equal to rhs, otherwise false
+template <class T, std::size_t S>
+bool operator!=(const IncrementalContainer<T, S>& lhs, const IncrementalContainer<T, S>& rhs);
+
+/// Writes a formatted representation of rhs to output.
+/// @returns output
+template <class T, std::size_t S>
+std::ostream& operator<<(std::ostream& output, const IncrementalContainer<T, S>& oset);
+
+// ============================================================================
+
+/// Copy ctor. The copy is compact: nothing is left to migrate.
+template <class T, std::size_t S>
+IncrementalContainer<T, S>::IncrementalContainer(const IncrementalContainer& other) {
+    reserve(other.size());
+    for (const auto& item : other) {
+        emplace_back(item);
+    }
+}
+
+/// Initializer List ctor
+template <class T, std::size_t S>
+IncrementalContainer<T, S>::IncrementalContainer(const std::initializer_list<value_type>& init) {
+    reserve(init.size());
+    for (const auto& item : init) {
+        emplace_back(item);
+    }
+}
+
+/// Destructor.
+template <class T, std::size_t S>
+IncrementalContainer<T, S>::~IncrementalContainer() {
+    clear();
+    std::allocator<T>{}.deallocate(data, allocated);
+}
+
+/// Replaces the contents of the container with a copy of the contents of rhs.
+template <class T, std::size_t S>
+IncrementalContainer<T, S>& IncrementalContainer<T, S>::operator=(const IncrementalContainer& rhs) {
+    if (this != &rhs) {
+        IncrementalContainer copy(rhs);
+        swap(copy);
+    }
+    return *this;
+}
+
+/// Moves the contents of the container instead of replacing.
+template <class T, std::size_t S>
+IncrementalContainer<T, S>& IncrementalContainer<T, S>::operator=(IncrementalContainer&& rhs) noexcept {
+    if (this != &rhs) {
+        IncrementalContainer dead(std::move(rhs));
+        swap(dead);
+    }
+    return *this;
+}
+
+/// Starts migrating into a new array of new_cap slots.
+template <class T, std::size_t S>
+void IncrementalContainer<T, S>::grow(size_type new_cap) {
+    // a migration left unfinished by a small reserve() completes here
+    finish_migration();
+
+    pointer temp = std::allocator<T>{}.allocate(new_cap);
+
+    if (used == 0) {
+        std::allocator<T>{}.deallocate(data, allocated);
+    } else {
+        old_data = data;
+        old_allocated = allocated;
+        old_used = used;
+        migrated = 0;
+    }
+    data = temp;
+    allocated = new_cap;
+}
+
+/// Moves up to count elements from the old array, and releases the old
+/// array once it is empty.
+template <class T, std::size_t S>
+void IncrementalContainer<T, S>::migrate(size_type count) {
+    const size_type last = std::min(old_used, migrated + count);
+
+    for (; migrated < last; ++migrated) {
+        pointer source = old_data + migrated;
+
+        ::new (static_cast<void*>(data + migrated)) value_type(std::move_if_noexcept(*source));
+        source->~value_type();
+    }
+    if (migrating() && migrated == old_used) {
+        release_old();
+    }
+}
+
+/// Releases the old array, which must hold no elements.
+template <class T, std::size_t S>
+void IncrementalContainer<T, S>::release_old() {
+    std::allocator<T>{}.deallocate(old_data, old_allocated);
+    old_data = nullptr;
+    old_allocated = 0;
+    old_used = 0;
+    migrated = 0;
+}
+
+/// Destroys the elements in [first, last).
+template <class T, std::size_t S>
+void IncrementalContainer<T, S>::destroy(pointer first, pointer last) {
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+        for (; first != last; ++first) {
+            first->~value_type();
+        }
+    }
+}
+
+/// Grows the array to hold at least new_cap elements. Never shrinks.
+template <class T, std::size_t S>
+void IncrementalContainer<T, S>::reserve(size_type new_cap) {
+    if (new_cap > allocated) {
+        grow(new_cap);
+    }
+}
+
+/// Reallocates the array so that capacity() == size().
+template <class T, std::size_t S>
+void IncrementalContainer<T, S>::shrink_to_fit() {
+    finish_migration();
+    if (used == allocated) {
+        return;
+    }
+
+    pointer temp = used == 0 ? nullptr : std::allocator<T>{}.allocate(used);
+
+    for (size_type pos = 0; pos < used; ++pos) {
+        ::new (static_cast<void*>(temp + pos)) value_type(std::move_if_noexcept(data[pos]));
+    }
+    destroy(data, data + used);
+    std::allocator<T>{}.deallocate(data, allocated);
+    data = temp;
+    allocated = used;
+}
+
+/// Constructs an element in place at the end from args, then migrates up
+/// to Step old elements.
+/// @returns a reference to the new element.
+template <class T, std::size_t S>
+template <class... Args>
+T& IncrementalContainer<T, S>::emplace_back(Args&&... args) {
+    if (used == allocated) {
+        if (migrating()) {
+            // reserve() left too little room for the migration to finish, and
+            // args may refer to an element that finishing it would move
+            value_type value(std::forward<Args>(args)...);
+
+            grow(2 * allocated);
+            return emplace_back(std::move(value));
+        }
+        grow(allocated == 0 ? 8 : 2 * allocated);
+    }
+
+    // construct before migrating: args may refer to an element about to move
+    pointer slot = ::new (static_cast<void*>(data + used)) value_type(std::forward<Args>(args)...);
+
+    ++used;
+    migrate(S);
+    return *slot;
+}
+
+/// Destroys the last element, then migrates up to Step old elements.
+template <class T, std::size_t S>
+void IncrementalContainer<T, S>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("pop_back on empty IncrementalContainer");
+    }
+
+    --used;
+    slot(used)->~value_type();
+    old_used = std::min(old_used, used);
+    migrate(S);
+}
+
+/// Destroys every element. The current array is kept for reuse.
+template <class T, std::size_t S>
+void IncrementalContainer<T, S>::clear() {
+    if (migrating()) {
+        destroy(data, data + migrated);
+        destroy(old_data + migrated, old_data + old_used);
+        destroy(data + old_used, data + used);
+        release_old();
+    } else {
+        destroy(data, data + used);
+    }
+    used = 0;
+}
+
+/// Exchanges the contents of the container with those of other.
+template <class T, std::size_t S>
+void IncrementalContainer<T, S>::swap(IncrementalContainer& other) noexcept {
+    std::swap(data, other.data);
+    std::swap(allocated, other.allocated);
+    std::swap(used, other.used);
+    std::swap(old_data, other.old_data);
+    std::swap(old_allocated, other.old_allocated);
+    std::swap(old_used, other.old_used);
+    std::swap(migrated, other.migrated);
+}
+
+/// Finds the first element equal to the given target.
+/// @returns iterator to the element if found, or end() if not found.
+template <class T, std::size_t S>
+typename IncrementalContainer<T, S>::iterator
+IncrementalContainer<T, S>::find(const value_type& target) {
+    // search each contiguous run rather than routing every index
+    const std::pair<pointer, size_type> runs[] = {
+        { data, migrated }, { old_data, old_used }, { data, used }
+    };
+
+    for (size_type k = 0, first = 0; k < 3; first = runs[k].second, ++k) {
+        pointer begin = runs[k].first + first;
+        pointer end = runs[k].first + std::max(first, runs[k].second);
+        pointer match = std::find(begin, end, target);
+
+        if (match != end) {
+            return { this, static_cast<size_type>(match - runs[k].first) };
+        }
+    }
+    return end();
+}
+
+///
+template <class T, std::size_t S>
+typename IncrementalContainer<T, S>::const_iterator
+IncrementalContainer<T, S>::find(const value_type& target) const {
+    return const_cast<IncrementalContainer*>(this)->find(target);
+}
+
+///
+template <class T, std::size_t S>
+T& IncrementalContainer<T, S>::at(size_type pos) {
+    if (pos >= used) {
+        throw std::out_of_range("Out of bounds");
+    }
+    return (*this)[pos];
+}
+
+///
+template <class T, std::size_t S>
+const T& IncrementalContainer<T, S>::at(size_type pos) const {
+    if (pos >= used) {
+        throw std::out_of_range("Out of bounds");
+    }
+    return (*this)[pos];
+}
+
+// related non-member functions
+
+/// Equality comparison operator.
+/// @returns true if lhs compares equal to rhs, otherwise false
+template <class T, std::size_t S>
+bool operator==(const IncrementalContainer<T, S>& lhs, const IncrementalContainer<T, S>& rhs) {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+/// Inequality comparison operator.
+/// @returns true if lhs does not compare equal to rhs, otherwise false
+template <class T, std::size_t S>
+bool operator!=(const IncrementalContainer<T, S>& lhs, const IncrementalContainer<T, S>& rhs) {
+    return !(lhs == rhs);
+}
+
+/// Writes a formatted representation of rhs to output.
+/// @returns output
+template <class T, std::size_t S>
+std::ostream& operator<<(std::ostream& output, const IncrementalContainer<T, S>& oset) {
+    output << '{';
+
+    BufferedWriter writer(output);
+
+    for (auto item = oset.begin(); item != oset.end(); ++item) {
+        if (item != oset.begin()) {
+            writer.put(',');
+        }
+        writer.write(*item);
+    }
+
+    writer.put('}');
+
+    return output;
+}
+
+#endif /* INCREMENTAL_CONTAINER_HPP */
+
+/* EOF */
@@ -0,0 +1,170 @@
+/// @file MappedContainer-test.cpp
+/// @brief Catch2 Unit tests for the file-backed MappedContainer
+
+#define CATCH_CONFIG_MAIN
+#if defined __linux__
+#include <catch.hpp>
+#elif defined __MACH__
+#include </opt/local/include/catch2/catch.hpp>
+#else
+#include "catch.hpp"
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <system_error>
+
+#include <unistd.h>
+
+#include "MappedContainer.hpp"
+#include "MappedContainer.hpp"  // check include guard
+
+namespace {
+/// Creates an empty temporary file and removes it when the test ends.
+struct TempFile {
+    std::string path;
+
+    TempFile() {
+        char name[] = "/tmp/MappedContainer-test-XXXXXX";
+        const int fd = ::mkstemp(name);
+        REQUIRE(fd >= 0);
+        ::close(fd);
+        path = name;
+    }
+
+    ~TempFile() { std::remove(path.c_str()); }
+};
+}  // namespace
+
+TEMPLATE_TEST_CASE("MappedContainer(path)", "", char, int, double) {
+    TempFile file;
+    MappedContainer<TestType> box1(file.path);
+
+    CHECK(box1.size() == 0);
+    CHECK(box1.empty() == true);
+    CHECK(box1.begin() == box1.end());
+
+    MappedContainer<TestType> box2(file.path + ".reserved", 42);
+
+    CHECK(box2.empty() == true);
+    CHECK(box2.capacity() == 42);
+    std::remove((file.path + ".reserved").c_str());
+}
+
+TEMPLATE_TEST_CASE("MappedContainer push_back() and persistence", "", char, int, double) {
+    TempFile file;
+
+    {
+        MappedContainer<TestType> box1(file.path);
+
+        for (int i = 0; i < 1000; ++i) {
+            box1.push_back(TestType(i % 100));
+        }
+        CHECK(box1.size() == 1000);
+        box1.flush();
+    }
+
+    MappedContainer<TestType> box2(file.path);
+
+    REQUIRE(box2.size() == 1000);
+    for (size_t index = 0; index < box2.size(); ++index) {
+        CHECK(box2[index] == TestType(index % 100));
+    }
+
+    box2.shrink_to_fit();
+    CHECK(box2.capacity() == 1000);
+    CHECK(box2.at(999) == TestType(99));
+    CHECK_THROWS_AS(box2.at(1000), std::out_of_range);
+}
+
+TEMPLATE_TEST_CASE("MappedContainer erase() and find()", "", char, int, double) {
+    TempFile file;
+    MappedContainer<TestType> box1(file.path);
+
+    for (TestType value : { 42, 65, 66, 67, 42, 68 }) {
+        box1.push_back(value);
+    }
+
+    CHECK(box1.find(TestType{42}) == box1.begin());
+    CHECK(box1.find(TestType{42}, box1.begin() + 1) == box1.begin() + 4);
+    CHECK(box1.find(TestType{73}) == box1.end());
+
+    box1.erase(box1.begin());
+    box1.pop_back();
+    CHECK(box1.size() == 4);
+    CHECK(box1[0] == TestType(65));
+    CHECK(box1[3] == TestType(42));
+    CHECK_THROWS_AS(box1.erase(box1.end()), std::out_of_range);
+
+    box1.erase(nullptr);
+    CHECK(box1.size() == 4);
+
+    const auto& REF = box1;
+    CHECK(REF.find(TestType{42}) == REF.begin() + 3);
+    CHECK(REF.find(TestType{66}, REF.begin() + 2) == REF.end());
+
+    box1.clear();
+    CHECK(box1.empty() == true);
+    CHECK_THROWS_AS(box1.pop_back(), std::out_of_range);
+}
+
+TEST_CASE("MappedContainer rejects a file of another type") {
+    TempFile file;
+
+    {
+        MappedContainer<int> box1(file.path);
+        box1.push_back(42);
+    }
+
+    CHECK_THROWS_AS(MappedContainer<double>(file.path), std::runtime_error);
+    CHECK_NOTHROW(MappedContainer<int>(file.path));
+}
+
+TEST_CASE("MappedContainer closes the file if its reserve fails") {
+    TempFile file;
+
+    // the lowest free descriptor, which open() hands out next
+    const int next_fd = ::dup(0);
+    ::close(next_fd);
+
+    const auto too_many = std::numeric_limits<std::size_t>::max() / sizeof(double) / 2;
+    CHECK_THROWS_AS(MappedContainer<double>(file.path, too_many), std::system_error);
+
+    const int after = ::dup(0);
+    ::close(after);
+    CHECK(after == next_fd);
+
+    // the file is still usable
+    MappedContainer<double> box1(file.path, 4);
+    CHECK(box1.capacity() == 4);
+}
+
+TEST_CASE("MappedContainer move and swap") {
+    TempFile file1;
+    TempFile file2;
+    MappedContainer<int> box1(file1.path);
+    MappedContainer<int> box2(file2.path);
+
+    box1.push_back(65);
+    box2.push_back(66);
+    box2.push_back(67);
+
+    box1.swap(box2);
+    CHECK(box1.size() == 2);
+    CHECK(box2.size() == 1);
+
+    MappedContainer<int> box3(std::move(box1));
+    CHECK(box3.size() == 2);
+
+    box2 = std::move(box3);
+    CHECK(box2[1] == 67);
+
+    std::ostringstream output{};
+    output << box2;
+    CHECK(output.str() == "{66,67}");
+}
+
+/* EOF */
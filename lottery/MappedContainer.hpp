@@ -0,0 +1,406 @@
+/// @file MappedContainer.hpp
+/// @author Brandon Timok <8000477724@student.csn.edu>
+/// @date 03/14/2022
+/// @brief A MappedContainer stores trivially copyable values in a memory-mapped
+/// file. The values survive the process: reopening the file maps them back in
+/// without parsing anything. POSIX only.
+
+#ifndef MAPPED_CONTAINER_HPP
+#define MAPPED_CONTAINER_HPP
+#include <iostream>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <cerrno>
+#include <utility>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <algorithm>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "Container.hpp"
+
+/// A Container whose storage is a file mapped into memory. The file begins
+/// with a small header recording the element size and count, followed by
+/// capacity() elements. Growing extends the file and remaps it in place.
+template <class T, class Growth = DoublingGrowth>
+class MappedContainer {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "MappedContainer can only hold trivially copyable types");
+
+public:
+    /// Member types.
+    using value_type    = T;
+    using size_type     = std::size_t;
+    using pointer       = value_type*;
+    using const_pointer = const value_type*;
+
+    /// Opens the container stored in the file at path, creating an empty one
+    /// if the file does not exist, and reserves room for count elements.
+    /// @throws std::system_error if the file cannot be opened or mapped.
+    /// @throws std::runtime_error if the file holds something else.
+    explicit MappedContainer(const std::string& path, size_type count = 0);
+
+    MappedContainer(const MappedContainer&) = delete;
+    MappedContainer& operator=(const MappedContainer&) = delete;
+
+    /// Move ctor. The moved-from container may only be assigned to or destroyed.
+    MappedContainer(MappedContainer&& other)
+    : fd(std::exchange(other.fd, -1)),
+      length(std::exchange(other.length, 0)),
+      header(std::exchange(other.header, nullptr)) {}
+
+    /// Move assignment.
+    MappedContainer& operator=(MappedContainer&& rhs);
+
+    /// Destructor. Unmaps and closes the file; the contents stay on disk.
+    ~MappedContainer() { close(); }
+
+    /// Checks if the container has no elements, e.g begin() == end()
+    /// @returns true if the container is empty, false otherwise.
+    bool empty() const { return size() == 0; }
+
+    /// Returns the number of elements in the container.
+    size_type size() const { return header->used; }
+
+    /// Returns the number of elements the file can hold without growing.
+    size_type capacity() const { return (length - sizeof(Header)) / sizeof(value_type); }
+
+    /// Grows the file to hold at least new_cap elements. Never shrinks.
+    void reserve(size_type new_cap);
+
+    /// Truncates the file so that capacity() == size().
+    void shrink_to_fit();
+
+    /// Returns a pointer to the first element.
+    pointer begin() { return reinterpret_cast<pointer>(header + 1); }
+    const_pointer begin() const { return reinterpret_cast<const_pointer>(header + 1); }
+
+    /// Returns a pointer to the end (the element following the last element).
+    pointer end() { return begin() + size(); }
+    const_pointer end() const { return begin() + size(); }
+
+    /// Adds an element to the end.
+    void push_back(const value_type& value);
+
+    /// Removes the last element.
+    void pop_back();
+
+    /// Removes a single item from the container.
+    void erase(pointer pos);
+
+    /// After this call, size() returns zero. The capacity remains unchanged.
+    void clear() { header->used = 0; }
+
+    /// Exchanges the contents of the container with those of other.
+    void swap(MappedContainer& other);
+
+    /// Finds the first element equal to the given target. Search begins at pos.
+    /// @returns pointer to the element if found, or end() if not found.
+    pointer find(const value_type& target, pointer pos = nullptr);
+    const_pointer find(const value_type& target, const_pointer pos = nullptr) const;
+
+    /// Returns the value at the index chosen.
+    /// Checks for out of bounds.
+    T& at(size_type pos);
+    const T& at(size_type pos) const;
+
+    /// Returns the value at the index chosen.
+    /// Does not check for bounds.
+    T& operator[](size_type pos) { return *(begin() + pos); }
+    const T& operator[](size_type pos) const { return *(begin() + pos); }
+
+    /// Writes dirty pages back to the file and waits for the write to finish.
+    void flush();
+
+private:
+    /// Layout of the start of the file. Padded so the elements that follow
+    /// are suitably aligned.
+    struct alignas(alignof(value_type) > 64 ? alignof(value_type) : 64) Header {
+        char          magic[8];   ///< "CTNRMAP1"
+        std::uint64_t item_size;  ///< sizeof(value_type) when the file was made
+        std::uint64_t used;       ///< Number of items in container.
+    };
+
+    /// Resizes the file and the mapping to hold new_cap elements.
+    void remap(size_type new_cap);
+
+    /// Unmaps and closes the file, if open.
+    void close();
+
+    int     fd;       ///< Descriptor of the backing file.
+    size_t  length;   ///< Size of the file and of the mapping, in bytes.
+    Header* header;   ///< Start of the mapping.
+};
+
+// ============================================================================
+
+/// Opens the container stored in the file at path, creating an empty one if
+/// the file does not exist, and reserves room for count elements.
+template <class T, class G>
+MappedContainer<T, G>::MappedContainer(const std::string& path, size_type count)
+: fd(::open(path.c_str(), O_RDWR | O_CREAT, 0644)), length(0), header(nullptr) {
+    if (fd < 0) {
+        throw std::system_error(errno, std::generic_category(), "open " + path);
+    }
+
+    struct stat info{};
+
+    if (::fstat(fd, &info) != 0) {
+        const int error = errno;
+        close();
+        throw std::system_error(error, std::generic_category(), "fstat " + path);
+    }
+
+    const bool created = info.st_size == 0;
+
+    if (!created && static_cast<size_t>(info.st_size) < sizeof(Header)) {
+        close();
+        throw std::runtime_error(path + ": not a MappedContainer file");
+    }
+
+    length = created ? sizeof(Header) : static_cast<size_t>(info.st_size);
+    if (created && ::ftruncate(fd, length) != 0) {
+        const int error = errno;
+        close();
+        throw std::system_error(error, std::generic_category(), "ftruncate " + path);
+    }
+
+    void* mapping = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    if (mapping == MAP_FAILED) {
+        const int error = errno;
+        ::close(fd);
+        fd = -1;
+        throw std::system_error(error, std::generic_category(), "mmap " + path);
+    }
+    header = static_cast<Header*>(mapping);
+
+    if (created) {
+        std::memcpy(header->magic, "CTNRMAP1", sizeof header->magic);
+        header->item_size = sizeof(value_type);
+        header->used = 0;
+    } else if (std::memcmp(header->magic, "CTNRMAP1", sizeof header->magic) != 0
+               || header->item_size != sizeof(value_type)
+               || header->used > capacity()) {
+        close();
+        throw std::runtime_error(path + ": not a MappedContainer file of this type");
+    }
+
+    try {
+        reserve(count);
+    } catch (...) {
+        // the destructor does not run for a constructor that throws
+        close();
+        throw;
+    }
+}
+
+/// Move assignment.
+template <class T, class G>
+MappedContainer<T, G>& MappedContainer<T, G>::operator=(MappedContainer&& rhs) {
+    if (this != &rhs) {
+        close();
+        fd = std::exchange(rhs.fd, -1);
+        length = std::exchange(rhs.length, 0);
+        header = std::exchange(rhs.header, nullptr);
+    }
+    return *this;
+}
+
+/// Unmaps and closes the file, if open.
+template <class T, class G>
+void MappedContainer<T, G>::close() {
+    if (header != nullptr) {
+        ::munmap(header, length);
+        header = nullptr;
+    }
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+/// Resizes the file and the mapping to hold new_cap elements.
+template <class T, class G>
+void MappedContainer<T, G>::remap(size_type new_cap) {
+    const size_t new_length = sizeof(Header) + new_cap * sizeof(value_type);
+
+    if (new_length > length && ::ftruncate(fd, new_length) != 0) {
+        throw std::system_error(errno, std::generic_category(), "ftruncate");
+    }
+
+#if defined __linux__
+    void* mapping = ::mremap(header, length, new_length, MREMAP_MAYMOVE);
+#else
+    // the pages live in the file, so the new mapping sees everything the old
+    // one did; the old one is dropped only once the new one exists
+    void* mapping = ::mmap(nullptr, new_length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    if (mapping != MAP_FAILED) {
+        ::munmap(header, length);
+    }
+#endif
+
+    if (mapping == MAP_FAILED) {
+        throw std::system_error(errno, std::generic_category(), "mremap");
+    }
+    header = static_cast<Header*>(mapping);
+
+    if (new_length < length && ::ftruncate(fd, new_length) != 0) {
+        length = new_length;
+        throw std::system_error(errno, std::generic_category(), "ftruncate");
+    }
+    length = new_length;
+}
+
+/// Grows the file to hold at least new_cap elements. Never shrinks.
+template <class T, class G>
+void MappedContainer<T, G>::reserve(size_type new_cap) {
+    if (new_cap > capacity()) {
+        remap(new_cap);
+    }
+}
+
+/// Truncates the file so that capacity() == size().
+template <class T, class G>
+void MappedContainer<T, G>::shrink_to_fit() {
+    if (size() < capacity()) {
+        remap(size());
+    }
+}
+
+/// Adds an element to the end.
+template <class T, class G>
+void MappedContainer<T, G>::push_back(const value_type& value) {
+    if (size() == capacity()) {
+        // value may live in the mapping, which can move when it grows
+        const value_type copy = value;
+
+        remap(G::next_capacity(capacity(), size() + 1));
+        *end() = copy;
+    } else {
+        *end() = value;
+    }
+    ++header->used;
+}
+
+/// Removes the last element.
+template <class T, class G>
+void MappedContainer<T, G>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("pop_back on empty MappedContainer");
+    }
+    --header->used;
+}
+
+/// Removes a single item from the container.
+template <class T, class G>
+void MappedContainer<T, G>::erase(pointer pos) {
+    if (pos != nullptr) {
+        if (pos < begin() || pos >= end()) {
+            throw std::out_of_range("Out of bounds");
+        }
+        std::memmove(pos, pos + 1, (end() - pos - 1) * sizeof(value_type));
+        --header->used;
+    }
+}
+
+/// Exchanges the contents of the container with those of other.
+template <class T, class G>
+void MappedContainer<T, G>::swap(MappedContainer& other) {
+    std::swap(fd, other.fd);
+    std::swap(length, other.length);
+    std::swap(header, other.header);
+}
+
+/// Finds the first element equal to the given target. Search begins at pos.
+/// @returns pointer to the element if found, or end() if not found.
+template <class T, class G>
+typename MappedContainer<T, G>::pointer
+MappedContainer<T, G>::find(const value_type& target, pointer pos) {
+    auto first = pos == nullptr ? begin() : pos;
+
+    if constexpr (simd::is_supported_v<T>) {
+        return first + simd::find(first, end() - first, target);
+    } else {
+        return std::find(first, end(), target);
+    }
+}
+
+///
+template <class T, class G>
+typename MappedContainer<T, G>::const_pointer
+MappedContainer<T, G>::find(const value_type& target, const_pointer pos) const {
+    return const_cast<MappedContainer*>(this)->find(target, const_cast<pointer>(pos));
+}
+
+///
+template <class T, class G>
+T& MappedContainer<T, G>::at(size_type pos) {
+    if (pos >= size()) {
+        throw std::out_of_range("Out of bounds");
+    }
+    return begin()[pos];
+}
+
+///
+template <class T, class G>
+const T& MappedContainer<T, G>::at(size_type pos) const {
+    if (pos >= size()) {
+        throw std::out_of_range("Out of bounds");
+    }
+    return begin()[pos];
+}
+
+/// Writes dirty pages back to the file and waits for the write to finish.
+template <class T, class G>
+void MappedContainer<T, G>::flush() {
+    if (::msync(header, length, MS_SYNC) != 0) {
+        throw std::system_error(errno, std::generic_category(), "msync");
+    }
+}
+
+// related non-member functions
+
+/// Equality comparison operator.
+/// @returns true if lhs compares equal to rhs, otherwise false
+template <class T, class G>
+bool operator==(const MappedContainer<T, G>& lhs, const MappedContainer<T, G>& rhs) {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+/// Inequality comparison operator.
+/// @returns true if lhs does not compare equal to rhs, otherwise false
+template <class T, class G>
+bool operator!=(const MappedContainer<T, G>& lhs, const MappedContainer<T, G>& rhs) {
+    return !(lhs == rhs);
+}
+
+/// Writes a formatted representation of rhs to output.
+/// @returns output
+template <class T, class G>
+std::ostream& operator<<(std::ostream& output, const MappedContainer<T, G>& oset) {
+    char separator[2] = "";
+
+    output << '{';
+
+    for (const auto& item : oset) {
+        output << separator << item;
+        *separator = ',';
+    }
+
+    output << '}';
+
+    return output;
+}
+
+#endif /* MAPPED_CONTAINER_HPP */
+
+/* EOF */
@@ -0,0 +1,202 @@
+/// @file SegmentedContainer-test.cpp
+/// @brief Catch2 Unit tests for the pointer-stable SegmentedContainer
+
+#define CATCH_CONFIG_MAIN
+#if defined __linux__
+#include <catch.hpp>
+#elif defined __MACH__
+#include </opt/local/include/catch2/catch.hpp>
+#else
+#include "catch.hpp"
+#endif
+
+#include <algorithm>
+#include <initializer_list>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "SegmentedContainer.hpp"
+#include "SegmentedContainer.hpp"  // check include guard
+
+namespace {
+/// Element type that counts live instances; copying a negative one throws.
+struct Fragile {
+    static int live;
+    int value;
+
+    explicit Fragile(int v) : value(v) { ++live; }
+    Fragile(const Fragile& other) : value(other.value) {
+        if (value < 0) {
+            throw std::runtime_error("copy failed");
+        }
+        ++live;
+    }
+    ~Fragile() { --live; }
+};
+
+int Fragile::live = 0;
+}  // namespace
+
+TEMPLATE_TEST_CASE("SegmentedContainer()", "", char, int, double) {
+    SegmentedContainer<TestType> box1{};
+
+    CHECK(box1.size() == 0);
+    CHECK(box1.empty() == true);
+    CHECK(box1.capacity() == 0);
+    CHECK(box1.begin() == box1.end());
+}
+
+TEMPLATE_TEST_CASE("SegmentedContainer(initializer_list)", "", char, int, double) {
+    const SegmentedContainer<TestType> box1 { 65, 66, 67, 68, 69, 70, 71, 72, 73, 74 };
+    const TestType EXPECTED[] = { 65, 66, 67, 68, 69, 70, 71, 72, 73, 74 };
+
+    REQUIRE(box1.size() == 10);
+    CHECK(box1.capacity() == 24);
+    CHECK(std::equal(box1.begin(), box1.end(), std::begin(EXPECTED), std::end(EXPECTED)));
+}
+
+TEMPLATE_TEST_CASE("SegmentedContainer push_back() keeps elements in place", "", char, int, double) {
+    SegmentedContainer<TestType> box1{};
+    std::vector<const TestType*> addresses{};
+
+    for (int i = 0; i < 5000; ++i) {
+        box1.push_back(TestType(i % 100));
+        addresses.push_back(&box1[i]);
+    }
+
+    REQUIRE(box1.size() == 5000);
+    for (int i = 0; i < 5000; ++i) {
+        CHECK(&box1[i] == addresses[i]);
+        CHECK(box1[i] == TestType(i % 100));
+    }
+}
+
+TEMPLATE_TEST_CASE("SegmentedContainer at() and operator[]", "", char, int, double) {
+    SegmentedContainer<TestType> box1{};
+
+    for (int i = 0; i < 300; ++i) {
+        box1.push_back(TestType(i % 100));
+    }
+
+    // the first and last element of every block
+    for (std::size_t pos : { 0, 7, 8, 23, 24, 55, 56, 119, 120, 247, 248, 299 }) {
+        CHECK(box1[pos] == TestType(pos % 100));
+        CHECK(box1.at(pos) == TestType(pos % 100));
+    }
+    CHECK_THROWS_AS(box1.at(300), std::out_of_range);
+}
+
+TEMPLATE_TEST_CASE("SegmentedContainer iterators", "", char, int, double) {
+    SegmentedContainer<TestType> box1 { 70, 65, 68, 66, 69, 67 };
+
+    std::sort(box1.begin(), box1.end());
+
+    CHECK(box1 == SegmentedContainer<TestType>{ 65, 66, 67, 68, 69, 70 });
+    CHECK(box1.end() - box1.begin() == 6);
+    CHECK(*(box1.begin() + 2) == TestType(67));
+    CHECK(box1.begin()[5] == TestType(70));
+
+    typename SegmentedContainer<TestType>::const_iterator first = box1.begin();
+    CHECK(first == box1.begin());
+}
+
+TEMPLATE_TEST_CASE("SegmentedContainer find()", "", char, int, double) {
+    SegmentedContainer<TestType> box1{};
+
+    for (int i = 0; i < 100; ++i) {
+        box1.push_back(TestType(i));
+    }
+
+    CHECK(box1.find(TestType(0)) == box1.begin());
+    CHECK(box1.find(TestType(50)) == box1.begin() + 50);
+    CHECK(box1.find(TestType(99)) == box1.begin() + 99);
+    CHECK(box1.find(TestType(100)) == box1.end());
+}
+
+TEMPLATE_TEST_CASE("SegmentedContainer copy and move", "", char, int, double) {
+    const SegmentedContainer<TestType> REF { 65, 66, 67, 68, 69, 70, 71, 72, 73 };
+
+    SegmentedContainer<TestType> box1 { REF };
+    CHECK(box1 == REF);
+
+    const TestType* first = &box1[0];
+    SegmentedContainer<TestType> box2 { std::move(box1) };
+    CHECK(box2 == REF);
+    CHECK(&box2[0] == first);
+    CHECK(box1.empty() == true);
+
+    box1 = box2;
+    CHECK(box1 == REF);
+
+    box1.push_back(TestType(42));
+    CHECK(box1 != REF);
+
+    box2 = std::move(box1);
+    CHECK(box2.size() == 10);
+}
+
+TEMPLATE_TEST_CASE("SegmentedContainer pop_back(), clear() and shrink_to_fit()", "", char, int, double) {
+    SegmentedContainer<TestType> box1{};
+
+    for (int i = 0; i < 100; ++i) {
+        box1.push_back(TestType(i));
+    }
+    CHECK(box1.capacity() == 120);
+
+    while (box1.size() > 20) {
+        box1.pop_back();
+    }
+    box1.shrink_to_fit();
+    CHECK(box1.capacity() == 24);
+    CHECK(box1[19] == TestType(19));
+
+    box1.clear();
+    CHECK(box1.empty() == true);
+    CHECK(box1.capacity() == 24);
+    CHECK_THROWS_AS(box1.pop_back(), std::out_of_range);
+
+    box1.shrink_to_fit();
+    CHECK(box1.capacity() == 0);
+}
+
+TEST_CASE("SegmentedContainer copies clean up when an element throws") {
+    {
+        SegmentedContainer<Fragile> box1{};
+        for (int i = 0; i < 100; ++i) {
+            box1.emplace_back(i);
+        }
+        box1.emplace_back(-1);
+        REQUIRE(Fragile::live == 101);
+
+        CHECK_THROWS_AS(SegmentedContainer<Fragile>(box1), std::runtime_error);
+        CHECK(Fragile::live == 101);
+
+        CHECK_THROWS_AS(SegmentedContainer<Fragile>({ Fragile(1), Fragile(2), Fragile(-1) }),
+                        std::runtime_error);
+        CHECK(Fragile::live == 101);
+    }
+    CHECK(Fragile::live == 0);
+}
+
+TEST_CASE("SegmentedContainer<std::string>") {
+    SegmentedContainer<std::string> box1{};
+
+    for (int i = 0; i < 100; ++i) {
+        box1.emplace_back(40, static_cast<char>('A' + i % 26));
+    }
+    const std::string* middle = &box1[50];
+
+    for (int i = 0; i < 1000; ++i) {
+        box1.push_back("x");
+    }
+    CHECK(&box1[50] == middle);
+    CHECK(*middle == std::string(40, 'Y'));
+
+    std::ostringstream output{};
+    output << SegmentedContainer<std::string>{ "Alpha", "Bravo" };
+    CHECK(output.str() == "{Alpha,Bravo}");
+}
+
+/* EOF */
@@ -0,0 +1,486 @@
+/// @file SegmentedContainer.hpp
+/// @author Brandon Timok <8000477724@student.csn.edu>
+/// @date 03/14/2022
+/// @brief A SegmentedContainer stores its values in a table of blocks whose
+/// sizes double. Growing adds a block and never moves an element, so
+/// pointers and references to an element stay valid until it is removed.
+
+#ifndef SEGMENTED_CONTAINER_HPP
+#define SEGMENTED_CONTAINER_HPP
+#include <initializer_list>
+#include <iostream>
+#include <cstdlib>
+#include <cstddef>
+#include <utility>
+#include <stdexcept>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+#include "../common/BufferedWriter.hpp"
+
+/// Block geometry shared by the segmented containers: block k holds
+/// 2^(Shift + k) elements, so the block holding an index, and the offset
+/// within it, follow from the highest set bit of index + 2^Shift.
+template <unsigned Shift>
+struct DoublingBlocks {
+    /// Number of elements in the first block.
+    static constexpr std::size_t first_block = std::size_t{1} << Shift;
+
+    /// Size of a block table with room for any index a size_t holds.
+    static constexpr std::size_t max_blocks = std::numeric_limits<std::size_t>::digits - Shift - 1;
+
+    /// Returns the number of elements block k holds.
+    static constexpr std::size_t block_size(std::size_t k) { return first_block << k; }
+
+    /// Returns the index of the first element of block k, which is also the
+    /// number of elements blocks 0 to k-1 hold together.
+    static constexpr std::size_t block_start(std::size_t k) {
+        return first_block * ((std::size_t{1} << k) - 1);
+    }
+
+    /// Returns the position of the highest set bit of value, which is not 0.
+    static unsigned highest_bit(std::size_t value) {
+#if defined __GNUC__ || defined __clang__
+        return std::numeric_limits<unsigned long long>::digits - 1 - __builtin_clzll(value);
+#else
+        unsigned bit = 0;
+
+        while (value >>= 1) {
+            ++bit;
+        }
+        return bit;
+#endif
+    }
+
+    /// Returns the block holding index pos, and the offset of pos within it.
+    static std::pair<std::size_t, std::size_t> locate(std::size_t pos) {
+        const std::size_t biased = pos + first_block;
+        const unsigned bit = highest_bit(biased);
+
+        return { bit - Shift, biased - (std::size_t{1} << bit) };
+    }
+};
+
+/// A Container whose storage is a sequence of blocks of 8, 16, 32, ...
+/// elements. Indexing is O(1): the block holding an index is found from the
+/// position of its highest set bit. Appending never copies existing elements.
+template <class T>
+class SegmentedContainer {
+    template <bool Const>
+    class Iterator;
+
+public:
+    /// Member types.
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using pointer         = value_type*;
+    using const_pointer   = const value_type*;
+    using iterator        = Iterator<false>;
+    using const_iterator  = Iterator<true>;
+
+    /// Number of elements in the first block. Each further block doubles.
+    static constexpr size_type first_block = 8;
+
+    /// Default ctor. Allocates nothing.
+    SegmentedContainer() = default;
+
+    /// Copy ctor.
+    SegmentedContainer(const SegmentedContainer& other);
+
+    /// Move ctor. Takes over the blocks of other, which is left empty.
+    SegmentedContainer(SegmentedContainer&& other) noexcept { swap(other); }
+
+    /// Initializer List ctor
+    SegmentedContainer(const std::initializer_list<value_type>& init);
+
+    /// Destructor.
+    ~SegmentedContainer();
+
+    /// Replaces the contents of the container with a copy of the contents of rhs.
+    SegmentedContainer& operator=(const SegmentedContainer& rhs);
+
+    /// Moves the contents of the container instead of replacing.
+    SegmentedContainer& operator=(SegmentedContainer&& rhs) noexcept;
+
+    /// Checks if the container has no elements.
+    bool empty() const { return used == 0; }
+
+    /// Returns the number of elements in the container.
+    size_type size() const { return used; }
+
+    /// Returns the number of elements the allocated blocks can hold.
+    size_type capacity() const { return block_start(block_count); }
+
+    /// Allocates blocks until at least new_cap elements fit. Never shrinks.
+    void reserve(size_type new_cap);
+
+    /// Releases the blocks that hold no elements.
+    void shrink_to_fit();
+
+    /// Returns an iterator to the first element.
+    iterator begin() { return { this, 0 }; }
+    const_iterator begin() const { return { this, 0 }; }
+
+    /// Returns an iterator to the end (the element following the last element).
+    iterator end() { return { this, used }; }
+    const_iterator end() const { return { this, used }; }
+
+    /// Adds an element to the end. Existing elements do not move.
+    void push_back(const value_type& value) { emplace_back(value); }
+    void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+    /// Constructs an element in place at the end from args.
+    /// @returns a reference to the new element.
+    template <class... Args>
+    T& emplace_back(Args&&... args);
+
+    /// Destroys the last element.
+    void pop_back();
+
+    /// Destroys every element. The blocks are kept for reuse.
+    void clear();
+
+    /// Exchanges the contents of the container with those of other.
+    void swap(SegmentedContainer& other) noexcept;
+
+    /// Finds the first element equal to the given target.
+    /// @returns iterator to the element if found, or end() if not found.
+    iterator find(const value_type& target);
+    const_iterator find(const value_type& target) const;
+
+    /// Returns the value at the index chosen.
+    /// Checks for out of bounds.
+    T& at(size_type pos);
+    const T& at(size_type pos) const;
+
+    /// Returns the value at the index chosen.
+    /// Does not check for bounds.
+    T& operator[](size_type pos);
+    const T& operator[](size_type pos) const;
+
+private:
+    using layout = DoublingBlocks<3>;
+    static_assert(layout::first_block == first_block, "first_block must match the layout");
+
+    static constexpr size_type max_blocks = layout::max_blocks;
+
+    static constexpr size_type block_size(size_type k) { return layout::block_size(k); }
+    static constexpr size_type block_start(size_type k) { return layout::block_start(k); }
+    static std::pair<size_type, size_type> locate(size_type pos) { return layout::locate(pos); }
+
+    /// Appends an empty block to the table.
+    void add_block();
+
+    /// Destroys the elements in [first, used) and shrinks used to match.
+    void destroy_from(size_type first);
+
+    pointer   blocks[max_blocks]{}; ///< Block k holds block_size(k) elements.
+    size_type block_count = 0;      ///< Number of blocks allocated.
+    size_type used = 0;             ///< Number of items in container.
+};
+
+/// Random access iterator over a SegmentedContainer. It holds an index, so
+/// it stays valid as the container grows.
+template <class T>
+template <bool Const>
+class SegmentedContainer<T>::Iterator {
+    using owner_type = std::conditional_t<Const, const SegmentedContainer, SegmentedContainer>;
+
+public:
+    // member types
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = std::conditional_t<Const, const T*, T*>;
+    using reference         = std::conditional_t<Const, const T&, T&>;
+
+    Iterator() = default;
+    Iterator(owner_type* owner, size_type pos) : owner(owner), pos(pos) {}
+
+    /// A mutable iterator converts to a const one.
+    template <bool C = Const, class = std::enable_if_t<!C>>
+    operator Iterator<true>() const { return { owner, pos }; }
+
+    reference operator*() const { return (*owner)[pos]; }
+    pointer operator->() const { return &(*owner)[pos]; }
+    reference operator[](difference_type n) const { return (*owner)[pos + n]; }
+
+    Iterator& operator++() { ++pos; return *this; }
+    Iterator operator++(int) { Iterator tmp = *this; ++pos; return tmp; }
+    Iterator& operator--() { --pos; return *this; }
+    Iterator operator--(int) { Iterator tmp = *this; --pos; return tmp; }
+
+    Iterator& operator+=(difference_type n) { pos += n; return *this; }
+    Iterator& operator-=(difference_type n) { pos -= n; return *this; }
+
+    friend Iterator operator+(Iterator itr, difference_type n) { return itr += n; }
+    friend Iterator operator+(difference_type n, Iterator itr) { return itr += n; }
+    friend Iterator operator-(Iterator itr, difference_type n) { return itr -= n; }
+
+    friend difference_type operator-(const Iterator& lhs, const Iterator& rhs) {
+        return static_cast<difference_type>(lhs.pos) - static_cast<difference_type>(rhs.pos);
+    }
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) { return lhs.pos == rhs.pos; }
+    friend bool operator!=(const Iterator& lhs, const Iterator& rhs) { return lhs.pos != rhs.pos; }
+    friend bool operator<(const Iterator& lhs, const Iterator& rhs) { return lhs.pos < rhs.pos; }
+    friend bool operator>(const Iterator& lhs, const Iterator& rhs) { return lhs.pos > rhs.pos; }
+    friend bool operator<=(const Iterator& lhs, const Iterator& rhs) { return lhs.pos <= rhs.pos; }
+    friend bool operator>=(const Iterator& lhs, const Iterator& rhs) { return lhs.pos >= rhs.pos; }
+
+private:
+    owner_type* owner = nullptr; ///< Container iterated over.
+    size_type   pos = 0;         ///< Index of the element referred to.
+};
+
+// related non-member functions
+
+/// Equality comparison operator.
+/// @returns true if lhs compares equal to rhs, otherwise false
+template <class T>
+bool operator==(const SegmentedContainer<T>& lhs, const SegmentedContainer<T>& rhs);
+
+/// Inequality comparison operator.
+/// @returns true if lhs does not compare equal to rhs, otherwise false
+template <class T>
+bool operator!=(const SegmentedContainer<T>& lhs, const SegmentedContainer<T>& rhs);
+
+/// Writes a formatted representation of rhs to output.
+/// @returns output
+template <class T>
+std::ostream& operator<<(std::ostream& output, const SegmentedContainer<T>& oset);
+
+// ============================================================================
+
+/// Copy ctor. Delegates first, so that if a copy throws the destructor
+/// frees the elements and blocks already made.
+template <class T>
+SegmentedContainer<T>::SegmentedContainer(const SegmentedContainer& other)
+: SegmentedContainer() {
+    reserve(other.size());
+    for (const auto& item : other) {
+        emplace_back(item);
+    }
+}
+
+/// Initializer List ctor
+template <class T>
+SegmentedContainer<T>::SegmentedContainer(const std::initializer_list<value_type>& init)
+: SegmentedContainer() {
+    reserve(init.size());
+    for (const auto& item : init) {
+        emplace_back(item);
+    }
+}
+
+/// Destructor.
+template <class T>
+SegmentedContainer<T>::~SegmentedContainer() {
+    clear();
+    for (size_type k = 0; k < block_count; ++k) {
+        std::allocator<T>{}.deallocate(blocks[k], block_size(k));
+    }
+}
+
+/// Replaces the contents of the container with a copy of the contents of rhs.
+template <class T>
+SegmentedContainer<T>& SegmentedContainer<T>::operator=(const SegmentedContainer& rhs) {
+    if (this != &rhs) {
+        SegmentedContainer copy(rhs);
+        swap(copy);
+    }
+    return *this;
+}
+
+/// Moves the contents of the container instead of replacing.
+template <class T>
+SegmentedContainer<T>& SegmentedContainer<T>::operator=(SegmentedContainer&& rhs) noexcept {
+    if (this != &rhs) {
+        SegmentedContainer dead(std::move(rhs));
+        swap(dead);
+    }
+    return *this;
+}
+
+/// Appends an empty block to the table.
+template <class T>
+void SegmentedContainer<T>::add_block() {
+    if (block_count == max_blocks) {
+        throw std::length_error("SegmentedContainer is full");
+    }
+    blocks[block_count] = std::allocator<T>{}.allocate(block_size(block_count));
+    ++block_count;
+}
+
+/// Allocates blocks until at least new_cap elements fit. Never shrinks.
+template <class T>
+void SegmentedContainer<T>::reserve(size_type new_cap) {
+    while (capacity() < new_cap) {
+        add_block();
+    }
+}
+
+/// Releases the blocks that hold no elements.
+template <class T>
+void SegmentedContainer<T>::shrink_to_fit() {
+    const size_type needed = empty() ? 0 : locate(used - 1).first + 1;
+
+    while (block_count > needed) {
+        --block_count;
+        std::allocator<T>{}.deallocate(blocks[block_count], block_size(block_count));
+        blocks[block_count] = nullptr;
+    }
+}
+
+/// Constructs an element in place at the end from args.
+/// @returns a reference to the new element.
+template <class T>
+template <class... Args>
+T& SegmentedContainer<T>::emplace_back(Args&&... args) {
+    if (used == capacity()) {
+        // the new block is added beside the old ones; nothing moves
+        add_block();
+    }
+
+    const auto [block, offset] = locate(used);
+    pointer slot = ::new (static_cast<void*>(blocks[block] + offset))
+                   value_type(std::forward<Args>(args)...);
+
+    ++used;
+    return *slot;
+}
+
+/// Destroys the last element.
+template <class T>
+void SegmentedContainer<T>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("pop_back on empty SegmentedContainer");
+    }
+    destroy_from(used - 1);
+}
+
+/// Destroys every element. The blocks are kept for reuse.
+template <class T>
+void SegmentedContainer<T>::clear() {
+    destroy_from(0);
+}
+
+/// Destroys the elements in [first, used) and shrinks used to match.
+template <class T>
+void SegmentedContainer<T>::destroy_from(size_type first) {
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+        for (size_type pos = first; pos < used; ++pos) {
+            (*this)[pos].~value_type();
+        }
+    }
+    used = first;
+}
+
+/// Exchanges the contents of the container with those of other.
+template <class T>
+void SegmentedContainer<T>::swap(SegmentedContainer& other) noexcept {
+    std::swap(blocks, other.blocks);
+    std::swap(block_count, other.block_count);
+    std::swap(used, other.used);
+}
+
+/// Finds the first element equal to the given target.
+/// @returns iterator to the element if found, or end() if not found.
+template <class T>
+typename SegmentedContainer<T>::iterator SegmentedContainer<T>::find(const value_type& target) {
+    // search a whole block at a time rather than locating every index
+    for (size_type k = 0, first = 0; first < used; first += block_size(k), ++k) {
+        const size_type count = std::min(block_size(k), used - first);
+        const_pointer match = std::find(blocks[k], blocks[k] + count, target);
+
+        if (match != blocks[k] + count) {
+            return { this, first + (match - blocks[k]) };
+        }
+    }
+    return end();
+}
+
+///
+template <class T>
+typename SegmentedContainer<T>::const_iterator
+SegmentedContainer<T>::find(const value_type& target) const {
+    return const_cast<SegmentedContainer*>(this)->find(target);
+}
+
+///
+template <class T>
+T& SegmentedContainer<T>::at(size_type pos) {
+    if (pos >= used) {
+        throw std::out_of_range("Out of bounds");
+    }
+    return (*this)[pos];
+}
+
+///
+template <class T>
+const T& SegmentedContainer<T>::at(size_type pos) const {
+    if (pos >= used) {
+        throw std::out_of_range("Out of bounds");
+    }
+    return (*this)[pos];
+}
+
+///
+template <class T>
+T& SegmentedContainer<T>::operator[](size_type pos) {
+    const auto [block, offset] = locate(pos);
+    return blocks[block][offset];
+}
+
+///
+template <class T>
+const T& SegmentedContainer<T>::operator[](size_type pos) const {
+    const auto [block, offset] = locate(pos);
+    return blocks[block][offset];
+}
+
+// related non-member functions
+
+/// Equality comparison operator.
+/// @returns true if lhs compares equal to rhs, otherwise false
+template <class T>
+bool operator==(const SegmentedContainer<T>& lhs, const SegmentedContainer<T>& rhs) {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+/// Inequality comparison operator.
+/// @returns true if lhs does not compare equal to rhs, otherwise false
+template <class T>
+bool operator!=(const SegmentedContainer<T>& lhs, const SegmentedContainer<T>& rhs) {
+    return !(lhs == rhs);
+}
+
+/// Writes a formatted representation of rhs to output.
+/// @returns output
+template <class T>
+std::ostream& operator<<(std::ostream& output, const SegmentedContainer<T>& oset) {
+    output << '{';
+
+    BufferedWriter writer(output);
+
+    for (auto item = oset.begin(); item != oset.end(); ++item) {
+        if (item != oset.begin()) {
+            writer.put(',');
+        }
+        writer.write(*item);
+    }
+
+    writer.put('}');
+
+    return output;
+}
+
+#endif /* SEGMENTED_CONTAINER_HPP */
+
+/* EOF */
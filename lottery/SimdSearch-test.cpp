@@ -0,0 +1,97 @@
+/// @file SimdSearch-test.cpp
+/// @brief Catch2 Unit tests for the vectorized search kernels
+
+#define CATCH_CONFIG_MAIN
+#if defined __linux__
+#include <catch.hpp>
+#elif defined __MACH__
+#include </opt/local/include/catch2/catch.hpp>
+#else
+#include "catch.hpp"
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "SimdSearch.hpp"
+#include "SimdSearch.hpp"  // check include guard
+
+TEMPLATE_TEST_CASE("simd::find()", "", char, unsigned char, int, std::uint32_t, float, double) {
+    // cover every tail length and an unaligned start for each vector width
+    for (std::size_t count = 0; count <= 100; ++count) {
+        std::vector<TestType> data(count + 1, TestType(1));
+        const TestType* first = data.data() + 1;
+
+        CHECK(simd::find(first, count, TestType(2)) == count);
+
+        for (std::size_t index = 0; index < count; ++index) {
+            data[index + 1] = TestType(2);
+            CHECK(simd::find(first, count, TestType(2)) == index);
+            data[index + 1] = TestType(1);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("simd::find() returns the first match", "", char, int, double) {
+    std::vector<TestType> data(70, TestType(0));
+
+    data[33] = TestType(42);
+    data[65] = TestType(42);
+
+    CHECK(simd::find(data.data(), data.size(), TestType(42)) == 33);
+    CHECK(simd::find(data.data() + 34, data.size() - 34, TestType(42)) == 31);
+}
+
+TEMPLATE_TEST_CASE("simd::equal()", "", char, unsigned char, int, std::uint32_t, float, double) {
+    for (std::size_t count = 0; count <= 100; ++count) {
+        std::vector<TestType> lhs(count, TestType(65));
+        std::vector<TestType> rhs(count, TestType(65));
+
+        CHECK(simd::equal(lhs.data(), rhs.data(), count) == true);
+
+        for (std::size_t index = 0; index < count; ++index) {
+            rhs[index] = TestType(66);
+            CHECK(simd::equal(lhs.data(), rhs.data(), count) == false);
+            rhs[index] = TestType(65);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("simd kernels follow operator== for floating point", "", float, double) {
+    const TestType nan = std::numeric_limits<TestType>::quiet_NaN();
+    std::vector<TestType> lhs(40, TestType(0.0));
+    std::vector<TestType> rhs(40, TestType(-0.0));
+
+    CHECK(simd::equal(lhs.data(), rhs.data(), lhs.size()) == true);
+    CHECK(simd::find(rhs.data(), rhs.size(), TestType(0.0)) == 0);
+
+    lhs[17] = rhs[17] = nan;
+    CHECK(simd::equal(lhs.data(), rhs.data(), lhs.size()) == false);
+    CHECK(simd::find(lhs.data(), lhs.size(), nan) == lhs.size());
+}
+
+#ifdef SIMD_SEARCH_X86
+TEMPLATE_TEST_CASE("SSE2 kernels match AVX2 kernels", "", char, int, double) {
+    std::vector<TestType> data(97);
+
+    for (std::size_t index = 0; index < data.size(); ++index) {
+        data[index] = TestType(index % 50);
+    }
+
+    for (int target = 0; target <= 50; ++target) {
+        const auto expected = std::find(data.begin(), data.end(), TestType(target)) - data.begin();
+
+        CHECK(simd::detail::find_sse2(data.data(), data.size(), TestType(target)) == size_t(expected));
+        if (simd::detail::has_avx2()) {
+            CHECK(simd::detail::find_avx2(data.data(), data.size(), TestType(target)) == size_t(expected));
+        }
+    }
+
+    CHECK(simd::detail::equal_sse2(data.data(), data.data(), data.size()) == true);
+    CHECK(simd::detail::equal_sse2(data.data(), data.data() + 1, data.size() - 1) == false);
+}
+#endif
+
+/* EOF */
@@ -0,0 +1,239 @@
+/// @file SimdSearch.hpp
+/// @author Brandon Timok <8000477724@student.csn.edu>
+/// @date 03/14/2022
+/// @brief Vectorized linear search and equality kernels for arrays of
+/// 1-byte and 4-byte integers, float and double. On x86 the AVX2 kernels are
+/// picked at run time when the CPU supports them, otherwise SSE2 is used.
+/// Other targets fall back to the scalar loops in <algorithm>.
+
+#ifndef SIMD_SEARCH_HPP
+#define SIMD_SEARCH_HPP
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#if (defined __x86_64__ || defined __i386__) && defined __SSE2__ \
+    && (defined __GNUC__ || defined __clang__)
+#define SIMD_SEARCH_X86 1
+#include <immintrin.h>
+#endif
+
+namespace simd {
+
+/// Checks whether T has a vectorized kernel.
+template <class T>
+struct is_supported
+: std::integral_constant<bool,
+      std::is_same<T, float>::value || std::is_same<T, double>::value
+      || (std::is_integral<T>::value && !std::is_same<T, bool>::value
+          && (sizeof(T) == 1 || sizeof(T) == 4))> {};
+
+template <class T>
+constexpr bool is_supported_v = is_supported<T>::value;
+
+/// Finds the first element of data[0, count) equal to target.
+/// @returns the index of the element if found, or count if not found.
+template <class T>
+std::size_t find(const T* data, std::size_t count, const T& target);
+
+/// Checks whether lhs[0, count) and rhs[0, count) compare equal element-wise.
+/// Floating point elements compare like operator==, so NaN never matches.
+template <class T>
+bool equal(const T* lhs, const T* rhs, std::size_t count);
+
+// ============================================================================
+
+namespace detail {
+
+#ifdef SIMD_SEARCH_X86
+
+/// Checks once whether the running CPU can execute AVX2 instructions.
+inline bool has_avx2() {
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+/// Returns a bitmask with one bit per lane that compares equal.
+template <class T>
+inline unsigned match_sse2(__m128i lhs, __m128i rhs) {
+    if constexpr (std::is_same<T, double>::value) {
+        return _mm_movemask_pd(_mm_cmpeq_pd(_mm_castsi128_pd(lhs), _mm_castsi128_pd(rhs)));
+    } else if constexpr (std::is_same<T, float>::value) {
+        return _mm_movemask_ps(_mm_cmpeq_ps(_mm_castsi128_ps(lhs), _mm_castsi128_ps(rhs)));
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(lhs, rhs)));
+    } else {
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(lhs, rhs));
+    }
+}
+
+/// Returns a bitmask with one bit per lane that compares equal.
+template <class T>
+__attribute__((target("avx2")))
+inline unsigned match_avx2(__m256i lhs, __m256i rhs) {
+    if constexpr (std::is_same<T, double>::value) {
+        return _mm256_movemask_pd(_mm256_cmp_pd(_mm256_castsi256_pd(lhs),
+                                                _mm256_castsi256_pd(rhs), _CMP_EQ_OQ));
+    } else if constexpr (std::is_same<T, float>::value) {
+        return _mm256_movemask_ps(_mm256_cmp_ps(_mm256_castsi256_ps(lhs),
+                                                _mm256_castsi256_ps(rhs), _CMP_EQ_OQ));
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(lhs, rhs)));
+    } else {
+        return static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, rhs)));
+    }
+}
+
+/// Broadcasts target into every lane of an SSE2 register.
+template <class T>
+inline __m128i splat_sse2(const T& target) {
+    if constexpr (std::is_same<T, double>::value) {
+        return _mm_castpd_si128(_mm_set1_pd(target));
+    } else if constexpr (std::is_same<T, float>::value) {
+        return _mm_castps_si128(_mm_set1_ps(target));
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm_set1_epi32(static_cast<int>(target));
+    } else {
+        return _mm_set1_epi8(static_cast<char>(target));
+    }
+}
+
+/// Broadcasts target into every lane of an AVX2 register.
+template <class T>
+__attribute__((target("avx2")))
+inline __m256i splat_avx2(const T& target) {
+    if constexpr (std::is_same<T, double>::value) {
+        return _mm256_castpd_si256(_mm256_set1_pd(target));
+    } else if constexpr (std::is_same<T, float>::value) {
+        return _mm256_castps_si256(_mm256_set1_ps(target));
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm256_set1_epi32(static_cast<int>(target));
+    } else {
+        return _mm256_set1_epi8(static_cast<char>(target));
+    }
+}
+
+/// SSE2 search: 16 bytes per compare.
+template <class T>
+std::size_t find_sse2(const T* data, std::size_t count, const T& target) {
+    constexpr std::size_t lanes = 16 / sizeof(T);
+    const __m128i needle = splat_sse2(target);
+    std::size_t index = 0;
+
+    for (; index + lanes <= count; index += lanes) {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+        const unsigned mask = match_sse2<T>(block, needle);
+
+        if (mask != 0) {
+            return index + __builtin_ctz(mask);
+        }
+    }
+    for (; index < count; ++index) {
+        if (data[index] == target) {
+            return index;
+        }
+    }
+    return count;
+}
+
+/// AVX2 search: 32 bytes per compare.
+template <class T>
+__attribute__((target("avx2")))
+std::size_t find_avx2(const T* data, std::size_t count, const T& target) {
+    constexpr std::size_t lanes = 32 / sizeof(T);
+    const __m256i needle = splat_avx2(target);
+    std::size_t index = 0;
+
+    for (; index + lanes <= count; index += lanes) {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + index));
+        const unsigned mask = match_avx2<T>(block, needle);
+
+        if (mask != 0) {
+            return index + __builtin_ctz(mask);
+        }
+    }
+    for (; index < count; ++index) {
+        if (data[index] == target) {
+            return index;
+        }
+    }
+    return count;
+}
+
+/// SSE2 comparison: 16 bytes per compare.
+template <class T>
+bool equal_sse2(const T* lhs, const T* rhs, std::size_t count) {
+    constexpr std::size_t lanes = 16 / sizeof(T);
+    constexpr unsigned all = sizeof(T) == 1 ? 0xFFFFu : (1u << lanes) - 1;
+    std::size_t index = 0;
+
+    for (; index + lanes <= count; index += lanes) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + index));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + index));
+
+        if (match_sse2<T>(a, b) != all) {
+            return false;
+        }
+    }
+    return std::equal(lhs + index, lhs + count, rhs + index);
+}
+
+/// AVX2 comparison: 32 bytes per compare.
+template <class T>
+__attribute__((target("avx2")))
+bool equal_avx2(const T* lhs, const T* rhs, std::size_t count) {
+    constexpr std::size_t lanes = 32 / sizeof(T);
+    constexpr unsigned all = sizeof(T) == 1 ? 0xFFFFFFFFu : (1u << lanes) - 1;
+    std::size_t index = 0;
+
+    for (; index + lanes <= count; index += lanes) {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + index));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + index));
+
+        if (match_avx2<T>(a, b) != all) {
+            return false;
+        }
+    }
+    return std::equal(lhs + index, lhs + count, rhs + index);
+}
+
+#endif /* SIMD_SEARCH_X86 */
+
+}  // namespace detail
+
+/// Finds the first element of data[0, count) equal to target.
+/// @returns the index of the element if found, or count if not found.
+template <class T>
+std::size_t find(const T* data, std::size_t count, const T& target) {
+    static_assert(is_supported_v<T>, "simd::find has no kernel for this type");
+#ifdef SIMD_SEARCH_X86
+    if (detail::has_avx2()) {
+        return detail::find_avx2(data, count, target);
+    }
+    return detail::find_sse2(data, count, target);
+#else
+    return std::find(data, data + count, target) - data;
+#endif
+}
+
+/// Checks whether lhs[0, count) and rhs[0, count) compare equal element-wise.
+/// Floating point elements compare like operator==, so NaN never matches.
+template <class T>
+bool equal(const T* lhs, const T* rhs, std::size_t count) {
+    static_assert(is_supported_v<T>, "simd::equal has no kernel for this type");
+#ifdef SIMD_SEARCH_X86
+    if (detail::has_avx2()) {
+        return detail::equal_avx2(lhs, rhs, count);
+    }
+    return detail::equal_sse2(lhs, rhs, count);
+#else
+    return std::equal(lhs, lhs + count, rhs);
+#endif
+}
+
+}  // namespace simd
+
+#endif /* SIMD_SEARCH_HPP */
+
+/* EOF */
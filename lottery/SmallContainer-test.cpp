@@ -0,0 +1,251 @@
+/// @file SmallContainer-test.cpp
+/// @brief Catch2 Unit tests for the inline-storage SmallContainer
+
+#define CATCH_CONFIG_MAIN
+#if defined __linux__
+#include <catch.hpp>
+#elif defined __MACH__
+#include </opt/local/include/catch2/catch.hpp>
+#else
+#include "catch.hpp"
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <sstream>
+#include <string>
+
+#include "SmallContainer.hpp"
+#include "SmallContainer.hpp"  // check include guard
+
+namespace {
+/// Checks that ptr points into the bytes of object.
+template <class Object, class Pointer>
+bool points_inside(const Object& object, Pointer ptr) {
+    auto first = reinterpret_cast<const unsigned char*>(&object);
+    auto target = reinterpret_cast<const unsigned char*>(ptr);
+    return target >= first && target < first + sizeof(Object);
+}
+
+/// An element type that needs more than the default new alignment.
+struct alignas(64) Wide {
+    Wide(int value = 0) : value(value) {}
+
+    bool operator==(const Wide& other) const { return value == other.value; }
+
+    int value;
+};
+}  // namespace
+
+TEMPLATE_TEST_CASE("SmallContainer(size_type)", "", char, int, double) {
+    SmallContainer<TestType, 4> box1{};
+
+    CHECK(box1.size() == 0);
+    CHECK(box1.empty() == true);
+    CHECK(box1.capacity() == 4);
+    CHECK(box1.is_inline() == true);
+
+    SmallContainer<TestType, 4> box2(42);
+
+    CHECK(box2.size() == 0);
+    CHECK(box2.capacity() == 42);
+    CHECK(box2.is_inline() == false);
+}
+
+TEMPLATE_TEST_CASE("SmallContainer push_back() stays inline up to N", "", char, int, double) {
+    SmallContainer<TestType, 5> box1{};
+
+    for (int i = 0; i < 5; ++i) {
+        box1.push_back(TestType(65 + i));
+        CHECK(box1.is_inline() == true);
+        CHECK(points_inside(box1, box1.begin()) == true);
+    }
+
+    box1.push_back(TestType(70));
+    CHECK(box1.is_inline() == false);
+    CHECK(points_inside(box1, box1.begin()) == false);
+    REQUIRE(box1.size() == 6);
+
+    for (size_t index = 0; index < box1.size(); ++index) {
+        CHECK(box1[index] == TestType(65 + index));
+    }
+
+    box1.resize(3);
+    box1.shrink_to_fit();
+    CHECK(box1.is_inline() == true);
+    CHECK(box1.capacity() == 5);
+    CHECK(box1[2] == TestType(67));
+}
+
+TEMPLATE_TEST_CASE("SmallContainer(const SmallContainer&)", "", char, int, double) {
+    const SmallContainer<TestType, 4> SMALL { 65, 66, 67 };
+    const SmallContainer<TestType, 4> LARGE { 65, 66, 67, 68, 69, 70, 71, 72 };
+
+    const SmallContainer<TestType, 4> box1(SMALL);
+    const SmallContainer<TestType, 4> box2(LARGE);
+
+    CHECK(box1 == SMALL);
+    CHECK(box1.is_inline() == true);
+    CHECK(box2 == LARGE);
+    CHECK(box2.begin() != LARGE.begin());
+}
+
+TEMPLATE_TEST_CASE("SmallContainer(SmallContainer&&)", "", char, int, double) {
+    SmallContainer<TestType, 4> small { 65, 66, 67 };
+    SmallContainer<TestType, 4> large { 65, 66, 67, 68, 69, 70, 71, 72 };
+    const auto heap = large.begin();
+
+    SmallContainer<TestType, 4> box1(std::move(small));
+    SmallContainer<TestType, 4> box2(std::move(large));
+
+    CHECK(box1 == SmallContainer<TestType, 4>{ 65, 66, 67 });
+    CHECK(box1.is_inline() == true);
+    CHECK(small.empty() == true);
+
+    CHECK(box2.begin() == heap);
+    CHECK(box2.size() == 8);
+    CHECK(large.empty() == true);
+    CHECK(large.is_inline() == true);
+}
+
+TEMPLATE_TEST_CASE("SmallContainer& operator=(SmallContainer&&)", "", char, int, double) {
+    const SmallContainer<TestType, 4> REF { 65, 66, 67, 68, 69, 70, 71, 72 };
+
+    SmallContainer<TestType, 4> box1 { 1, 2 };
+    box1 = SmallContainer<TestType, 4>(REF);
+    CHECK(box1 == REF);
+
+    box1 = SmallContainer<TestType, 4>{ 3 };
+    CHECK(box1.size() == 1);
+    CHECK(box1.is_inline() == true);
+
+    // check self-assignment
+    box1 = std::move(box1);
+    CHECK(box1.size() == 1);
+}
+
+TEMPLATE_TEST_CASE("SmallContainer& operator=(const SmallContainer&)", "", char, int, double) {
+    const SmallContainer<TestType, 4> REF { 65, 66, 67, 68, 69, 70, 71, 72 };
+
+    SmallContainer<TestType, 4> box1 { 1, 2 };
+    box1 = REF;
+    CHECK(box1 == REF);
+
+    box1 = SmallContainer<TestType, 4>{ 3 };
+    CHECK(box1.size() == 1);
+
+    // check self-assignment
+    box1 = box1;
+    CHECK(box1.size() == 1);
+}
+
+TEMPLATE_TEST_CASE("SmallContainer swap()", "", char, int, double) {
+    const SmallContainer<TestType, 4> SMALL { 65, 66 };
+    const SmallContainer<TestType, 4> LARGE { 65, 66, 67, 68, 69, 70 };
+
+    SmallContainer<TestType, 4> box1 { SMALL };
+    SmallContainer<TestType, 4> box2 { LARGE };
+
+    box1.swap(box2);
+    CHECK(box1 == LARGE);
+    CHECK(box2 == SMALL);
+    CHECK(box2.is_inline() == true);
+
+    box1.swap(box2);
+    CHECK(box1 == SMALL);
+    CHECK(box2 == LARGE);
+
+    SmallContainer<TestType, 4> box3 { LARGE };
+    box2.push_back(42);
+    box2.swap(box3);
+    CHECK(box2 == LARGE);
+    CHECK(box3.size() == LARGE.size() + 1);
+}
+
+TEMPLATE_TEST_CASE("SmallContainer erase() and find()", "", char, int, double) {
+    SmallContainer<TestType, 8> box1 { 42, 65, 66, 67, 42, 68 };
+
+    CHECK(box1.find(TestType{42}) == box1.begin());
+    CHECK(box1.find(TestType{42}, box1.begin() + 1) == box1.begin() + 4);
+    CHECK(box1.find(TestType{73}) == box1.end());
+
+    box1.erase(box1.begin());
+    CHECK(box1.size() == 5);
+    CHECK(box1[0] == TestType(65));
+    CHECK_THROWS_AS(box1.erase(box1.end()), std::out_of_range);
+    CHECK_THROWS_AS(box1.at(5), std::out_of_range);
+
+    box1.erase(nullptr);
+    CHECK(box1.size() == 5);
+
+    const auto& REF = box1;
+    CHECK(REF.find(TestType{67}) == REF.begin() + 2);
+    CHECK(REF.find(TestType{73}) == REF.end());
+}
+
+TEMPLATE_TEST_CASE("SmallContainer erase(first, last) and erase_if()", "", char, int, double) {
+    SmallContainer<TestType, 4> box1 { 65, 66, 67, 68, 69, 70 };
+    std::ostringstream output{};
+    std::ostringstream expected{};
+
+    CHECK(box1.erase(box1.begin() + 1, box1.begin() + 3) == box1.begin() + 1);
+    REQUIRE(box1.size() == 4);
+    CHECK(box1 == SmallContainer<TestType, 4> { 65, 68, 69, 70 });
+    CHECK(box1.erase(box1.end(), box1.end()) == box1.end());
+    CHECK_THROWS_AS(box1.erase(box1.begin() + 2, box1.begin() + 1), std::out_of_range);
+
+    CHECK(box1.erase_if([](TestType item) { return item > TestType(68); }) == 2);
+    CHECK(box1 == SmallContainer<TestType, 4> { 65, 68 });
+
+    output << box1;
+    expected << '{' << TestType(65) << ',' << TestType(68) << '}';
+    CHECK(output.str() == expected.str());
+}
+
+TEST_CASE("SmallContainer aligns over-aligned elements on the heap") {
+    SmallContainer<Wide, 2> box1;
+
+    for (int i = 0; i < 40; ++i) {
+        box1.emplace_back(i);
+        CHECK(reinterpret_cast<std::uintptr_t>(&box1.at(i)) % alignof(Wide) == 0);
+    }
+    CHECK_FALSE(box1.is_inline());
+
+    box1.erase(box1.begin() + 2, box1.end());
+    box1.shrink_to_fit();
+    CHECK(box1.is_inline());
+    CHECK(box1[1] == Wide(1));
+}
+
+TEMPLATE_TEST_CASE("SmallContainer operator+=() and operator+()", "", char, int, double) {
+    const SmallContainer<TestType, 4> REF { 65, 66, 67 };
+
+    SmallContainer<TestType, 4> box1 { REF };
+    box1 += box1;
+
+    REQUIRE(box1.size() == 6);
+    CHECK(std::equal(box1.begin(), box1.begin() + 3, REF.begin(), REF.end()));
+    CHECK(std::equal(box1.begin() + 3, box1.end(), REF.begin(), REF.end()));
+
+    CHECK((REF + REF) == box1);
+    CHECK((REF + REF) != REF);
+}
+
+TEST_CASE("SmallContainer with std::string") {
+    SmallContainer<std::string, 2> box1 { "Alpha", "Bravo" };
+    std::ostringstream output{};
+
+    box1.push_back(std::string(64, 'C'));
+    box1.emplace_back(3, 'D');
+
+    SmallContainer<std::string, 2> box2(std::move(box1));
+    box1 = box2;
+    box1.pop_back();
+
+    output << box1;
+    CHECK(output.str() == "{Alpha,Bravo," + std::string(64, 'C') + "}");
+    CHECK(box2[3] == "DDD");
+}
+
+/* EOF */
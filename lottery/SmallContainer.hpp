@@ -0,0 +1,597 @@
+/// @file SmallContainer.hpp
+/// @author Brandon Timok <8000477724@student.csn.edu>
+/// @date 03/14/2022
+/// @brief A SmallContainer is a Container that keeps up to N elements inside
+/// the object itself and only allocates from the heap once it grows past N.
+
+#ifndef SMALL_CONTAINER_HPP
+#define SMALL_CONTAINER_HPP
+#include <initializer_list>
+#include <iostream>
+#include <cstdlib>
+#include <utility>
+#include <stdexcept>
+#include <algorithm>
+#include <memory>
+#include <new>
+
+#include "Container.hpp"
+
+/// A Container with inline room for N elements. Small collections never touch
+/// the heap; larger ones spill to heap storage grown by the Growth policy.
+template <class T, std::size_t N, class Growth = DoublingGrowth>
+class SmallContainer {
+    static_assert(N > 0, "SmallContainer needs room for at least one element");
+
+public:
+    /// Member types.
+    using value_type    = T;
+    using size_type     = std::size_t;
+    using pointer       = value_type*;
+    using const_pointer = const value_type*;
+
+    /// Default ctor. Reserves room for count elements without constructing any.
+    SmallContainer(size_type count = 0);
+
+    /// Copy ctor.
+    SmallContainer(const SmallContainer& other);
+
+    /// Move ctor. Heap storage is stolen; inline elements are moved one by one.
+    SmallContainer(SmallContainer&& other);
+
+    /// Initializer List ctor
+    SmallContainer(const std::initializer_list<value_type>& init);
+
+    /// Destructor.
+    ~SmallContainer();
+
+    /// Checks if the container has no elements, e.g begin() == end()
+    /// @returns true if the container is empty, false otherwise.
+    bool empty() const { return begin() == end(); }
+
+    /// Returns the number of elements in the container.
+    size_type size() const { return used; }
+
+    /// Returns the number of elements that can be held without reallocating.
+    size_type capacity() const { return allocated; }
+
+    /// Checks whether the elements are stored inside the object.
+    bool is_inline() const { return data == inline_data(); }
+
+    /// Grows the storage to hold at least new_cap elements. Never shrinks.
+    void reserve(size_type new_cap);
+
+    /// Releases unused heap capacity, moving back inline if size() <= N.
+    void shrink_to_fit();
+
+    /// Returns a pointer to the first element.
+    pointer begin() { return data; }
+    const_pointer begin() const { return data; }
+
+    /// Returns a pointer to the end (the element following the last element).
+    pointer end() { return begin() + size(); }
+    const_pointer end() const { return begin() + size(); }
+
+    /// Adds an element to the end.
+    void push_back(const value_type& value) { emplace_back(value); }
+    void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+    /// Constructs an element in place at the end from args.
+    /// @returns a reference to the new element.
+    template <class... Args>
+    T& emplace_back(Args&&... args);
+
+    /// Destroys the last element.
+    void pop_back();
+
+    /// Resizes the container to hold count elements. New elements are
+    /// value-initialized; surplus elements are destroyed.
+    void resize(size_type count);
+
+    /// Removes a single item from the container.
+    void erase(pointer pos);
+
+    /// Removes the items in [first, last), shifting the tail down once.
+    /// @returns pointer to the element that followed the removed range.
+    pointer erase(pointer first, pointer last);
+
+    /// Removes every item for which pred returns true in a single pass.
+    /// @returns the number of items removed.
+    template <class Predicate>
+    size_type erase_if(Predicate pred);
+
+    /// Destroys every element. After this call, size() returns zero.
+    /// The capacity remains unchanged.
+    void clear();
+
+    /// Exchanges the contents of the container with those of other.
+    void swap(SmallContainer& other);
+
+    /// Finds the first element equal to the given target. Search begins at pos.
+    /// @returns pointer to the element if found, or end() if not found.
+    pointer find(const value_type& target, pointer pos = nullptr);
+    const_pointer find(const value_type& target, const_pointer pos = nullptr) const;
+
+    /// Replaces the contents of the container with a copy of the contents of rhs.
+    SmallContainer& operator=(const SmallContainer& rhs);
+
+    /// Moves the contents of the container instead of replacing.
+    SmallContainer& operator=(SmallContainer&& rhs);
+
+    /// Returns other appended to this.
+    /// @returns this
+    SmallContainer& operator+=(const SmallContainer& other);
+
+    /// Returns the value at the index chosen.
+    /// Checks for out of bounds.
+    T& at(size_type pos);
+    const T& at(size_type pos) const;
+
+    /// Returns the value at the index chosen.
+    /// Does not check for bounds.
+    T& operator[](size_type pos) { return *(begin() + pos); }
+    const T& operator[](size_type pos) const { return *(begin() + pos); }
+
+private:
+    /// Heap blocks for over-aligned types need the aligned operator new.
+    static constexpr bool over_aligned = alignof(value_type) > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+    /// Returns uninitialized heap storage for count elements.
+    static pointer allocate(size_type count);
+
+    /// Releases storage returned by allocate().
+    static void deallocate(pointer block) noexcept;
+
+    /// Returns the inline buffer viewed as an array of value_type.
+    pointer inline_data() { return reinterpret_cast<pointer>(buffer); }
+    const_pointer inline_data() const { return reinterpret_cast<const_pointer>(buffer); }
+
+    /// Destroys the elements in [first, end()) and shrinks used to match.
+    void destroy_from(pointer first);
+
+    /// Releases the heap storage, if any, and points back at the inline buffer.
+    void reset_storage();
+
+    /// Takes the elements of other, which is left empty and inline.
+    /// Precondition: this is empty and inline.
+    void steal(SmallContainer& other);
+
+    /// Moves the elements into storage for new_cap elements, which is the
+    /// inline buffer when new_cap <= N.
+    void reallocate(size_type new_cap);
+
+    /// Grows the storage and constructs a new last element from args.
+    template <class... Args>
+    T& grow_and_emplace(Args&&... args);
+
+    size_type allocated; ///< Physical capacity of container.
+    size_type used;      ///< Number of items in container.
+    pointer   data;      ///< Either the inline buffer or a heap array.
+    alignas(value_type) unsigned char buffer[N * sizeof(value_type)]; ///< Inline slots.
+};
+
+// related non-member functions
+
+/// Equality comparison operator.
+/// @returns true if lhs compares equal to rhs, otherwise false
+template <class T, std::size_t N, class G>
+bool operator==(const SmallContainer<T, N, G>& lhs, const SmallContainer<T, N, G>& rhs);
+
+/// Inequality comparison operator.
+/// @returns true if lhs does not compare equal to rhs, otherwise false
+template <class T, std::size_t N, class G>
+bool operator!=(const SmallContainer<T, N, G>& lhs, const SmallContainer<T, N, G>& rhs);
+
+/// Returns the concatenation of lhs and rhs.
+template <class T, std::size_t N, class G>
+SmallContainer<T, N, G> operator+(const SmallContainer<T, N, G>& lhs,
+                                  const SmallContainer<T, N, G>& rhs);
+
+/// Writes a formatted representation of rhs to output.
+/// @returns output
+template <class T, std::size_t N, class G>
+std::ostream& operator<<(std::ostream& output, const SmallContainer<T, N, G>& oset);
+
+// ============================================================================
+
+/// Default ctor. Reserves room for count elements without constructing any.
+template <class T, std::size_t N, class G>
+SmallContainer<T, N, G>::SmallContainer(size_type count)
+: allocated(N), used(0), data(inline_data()) {
+    reserve(count);
+}
+
+/// Copy ctor.
+template <class T, std::size_t N, class G>
+SmallContainer<T, N, G>::SmallContainer(const SmallContainer& other)
+: SmallContainer(other.size()) {
+    std::uninitialized_copy(other.begin(), other.end(), begin());
+    used = other.size();
+}
+
+/// Move ctor. Heap storage is stolen; inline elements are moved one by one.
+template <class T, std::size_t N, class G>
+SmallContainer<T, N, G>::SmallContainer(SmallContainer&& other)
+: SmallContainer() {
+    steal(other);
+}
+
+/// Initializer List ctor
+template <class T, std::size_t N, class G>
+SmallContainer<T, N, G>::SmallContainer(const std::initializer_list<value_type>& init)
+: SmallContainer(init.size()) {
+    std::uninitialized_copy(init.begin(), init.end(), begin());
+    used = init.size();
+}
+
+/// Destructor.
+template <class T, std::size_t N, class G>
+SmallContainer<T, N, G>::~SmallContainer() {
+    std::destroy(begin(), end());
+    if (!is_inline()) {
+        deallocate(data);
+    }
+}
+
+///
+template <class T, std::size_t N, class G>
+T& SmallContainer<T, N, G>::at(size_type pos) {
+    if (pos >= used) {
+        throw std::out_of_range("Out of bounds");
+    }
+    return data[pos];
+}
+
+///
+template <class T, std::size_t N, class G>
+const T& SmallContainer<T, N, G>::at(size_type pos) const {
+    if (pos >= used) {
+        throw std::out_of_range("Out of bounds");
+    }
+    return data[pos];
+}
+
+/// Grows the storage to hold at least new_cap elements. Never shrinks.
+template <class T, std::size_t N, class G>
+void SmallContainer<T, N, G>::reserve(size_type new_cap) {
+    if (new_cap > allocated) {
+        reallocate(new_cap);
+    }
+}
+
+/// Releases unused heap capacity, moving back inline if size() <= N.
+template <class T, std::size_t N, class G>
+void SmallContainer<T, N, G>::shrink_to_fit() {
+    if (!is_inline() && used < allocated) {
+        reallocate(used);
+    }
+}
+
+/// Returns uninitialized heap storage for count elements.
+template <class T, std::size_t N, class G>
+typename SmallContainer<T, N, G>::pointer SmallContainer<T, N, G>::allocate(size_type count) {
+    if constexpr (over_aligned) {
+        return static_cast<pointer>(::operator new(count * sizeof(value_type),
+                                                   std::align_val_t(alignof(value_type))));
+    } else {
+        return static_cast<pointer>(::operator new(count * sizeof(value_type)));
+    }
+}
+
+/// Releases storage returned by allocate().
+template <class T, std::size_t N, class G>
+void SmallContainer<T, N, G>::deallocate(pointer block) noexcept {
+    if constexpr (over_aligned) {
+        ::operator delete(block, std::align_val_t(alignof(value_type)));
+    } else {
+        ::operator delete(block);
+    }
+}
+
+/// Destroys the elements in [first, end()) and shrinks used to match.
+template <class T, std::size_t N, class G>
+void SmallContainer<T, N, G>::destroy_from(pointer first) {
+    std::destroy(first, end());
+    used = first - begin();
+}
+
+/// Releases the heap storage, if any, and points back at the inline buffer.
+/// Precondition: the container is empty.
+template <class T, std::size_t N, class G>
+void SmallContainer<T, N, G>::reset_storage() {
+    if (!is_inline()) {
+        deallocate(data);
+        data = inline_data();
+        allocated = N;
+    }
+}
+
+/// Takes the elements of other, which is left empty and inline.
+/// Precondition: this is empty and inline.
+template <class T, std::size_t N, class G>
+void SmallContainer<T, N, G>::steal(SmallContainer& other) {
+    if (other.is_inline()) {
+        std::uninitialized_move(other.begin(), other.end(), begin());
+        used = other.size();
+        other.clear();
+    } else {
+        allocated = std::exchange(other.allocated, N);
+        used = std::exchange(other.used, 0);
+        data = std::exchange(other.data, other.inline_data());
+    }
+}
+
+/// Moves the elements into storage for new_cap elements, which is the
+/// inline buffer when new_cap <= N.
+template <class T, std::size_t N, class G>
+void SmallContainer<T, N, G>::reallocate(size_type new_cap) {
+    const bool to_inline = new_cap <= N;
+    pointer temp = to_inline ? inline_data() : allocate(new_cap);
+
+    try {
+        std::uninitialized_move(begin(), end(), temp);
+    } catch (...) {
+        if (!to_inline) {
+            deallocate(temp);
+        }
+        throw;
+    }
+
+    std::destroy(begin(), end());
+    if (!is_inline()) {
+        deallocate(data);
+    }
+    data = temp;
+    allocated = to_inline ? N : new_cap;
+}
+
+/// Constructs an element in place at the end from args.
+/// @returns a reference to the new element.
+template <class T, std::size_t N, class G>
+template <class... Args>
+T& SmallContainer<T, N, G>::emplace_back(Args&&... args) {
+    if (size() == allocated) {
+        return grow_and_emplace(std::forward<Args>(args)...);
+    }
+
+    pointer slot = ::new (static_cast<void*>(end())) value_type(std::forward<Args>(args)...);
+    ++used;
+    return *slot;
+}
+
+/// Grows the storage and constructs a new last element from args.
+template <class T, std::size_t N, class G>
+template <class... Args>
+T& SmallContainer<T, N, G>::grow_and_emplace(Args&&... args) {
+    const size_type new_cap = G::next_capacity(allocated, size() + 1);
+    pointer temp = allocate(new_cap);
+    pointer slot = temp + size();
+
+    // construct the new element first: args may refer to an element of this
+    try {
+        ::new (static_cast<void*>(slot)) value_type(std::forward<Args>(args)...);
+    } catch (...) {
+        deallocate(temp);
+        throw;
+    }
+
+    try {
+        std::uninitialized_move(begin(), end(), temp);
+    } catch (...) {
+        slot->~value_type();
+        deallocate(temp);
+        throw;
+    }
+
+    std::destroy(begin(), end());
+    if (!is_inline()) {
+        deallocate(data);
+    }
+    data = temp;
+    allocated = new_cap;
+    ++used;
+    return *slot;
+}
+
+/// Destroys the last element.
+template <class T, std::size_t N, class G>
+void SmallContainer<T, N, G>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("pop_back on empty SmallContainer");
+    }
+    destroy_from(end() - 1);
+}
+
+/// Resizes the container to hold count elements, value-initializing new ones.
+template <class T, std::size_t N, class G>
+void SmallContainer<T, N, G>::resize(size_type count) {
+    if (count < size()) {
+        destroy_from(begin() + count);
+    } else if (count > size()) {
+        reserve(count);
+        std::uninitialized_value_construct(end(), begin() + count);
+        used = count;
+    }
+}
+
+/// Removes a single item from the container.
+template <class T, std::size_t N, class G>
+void SmallContainer<T, N, G>::erase(pointer pos) {
+    if (pos != nullptr) {
+        if (pos < begin() || pos >= end()) {
+            throw std::out_of_range("Out of bounds");
+        }
+        std::move(pos + 1, end(), pos);
+        destroy_from(end() - 1);
+    }
+}
+
+/// Removes the items in [first, last), shifting the tail down once.
+/// @returns pointer to the element that followed the removed range.
+template <class T, std::size_t N, class G>
+typename SmallContainer<T, N, G>::pointer
+SmallContainer<T, N, G>::erase(pointer first, pointer last) {
+    if (first < begin() || last > end() || first > last) {
+        throw std::out_of_range("Out of bounds");
+    }
+    if (first != last) {
+        destroy_from(std::move(last, end(), first));
+    }
+    return first;
+}
+
+/// Removes every item for which pred returns true in a single pass.
+/// @returns the number of items removed.
+template <class T, std::size_t N, class G>
+template <class Predicate>
+typename SmallContainer<T, N, G>::size_type SmallContainer<T, N, G>::erase_if(Predicate pred) {
+    const size_type before = size();
+
+    destroy_from(std::remove_if(begin(), end(), pred));
+    return before - size();
+}
+
+/// Destroys every element. The capacity remains unchanged.
+template <class T, std::size_t N, class G>
+void SmallContainer<T, N, G>::clear() {
+    destroy_from(begin());
+}
+
+/// Exchanges the contents of the container with those of other.
+template <class T, std::size_t N, class G>
+void SmallContainer<T, N, G>::swap(SmallContainer& other) {
+    if (this == &other) {
+        return;
+    }
+    if (!is_inline() && !other.is_inline()) {
+        std::swap(allocated, other.allocated);
+        std::swap(used, other.used);
+        std::swap(data, other.data);
+    } else {
+        SmallContainer temp(std::move(other));
+
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+}
+
+/// Finds the first element equal to the given target. Search begins at pos.
+/// @returns pointer to the element if found, or end() if not found.
+template <class T, std::size_t N, class G>
+typename SmallContainer<T, N, G>::pointer
+SmallContainer<T, N, G>::find(const value_type& target, pointer pos) {
+    auto first = pos == nullptr ? begin() : pos;
+
+    if constexpr (simd::is_supported_v<T>) {
+        return first + simd::find(first, end() - first, target);
+    } else {
+        return std::find(first, end(), target);
+    }
+}
+
+///
+template <class T, std::size_t N, class G>
+typename SmallContainer<T, N, G>::const_pointer
+SmallContainer<T, N, G>::find(const value_type& target, const_pointer pos) const {
+    return const_cast<SmallContainer*>(this)->find(target, const_cast<pointer>(pos));
+}
+
+/// Replaces the contents of the container with a copy of the contents of rhs.
+template <class T, std::size_t N, class G>
+SmallContainer<T, N, G>& SmallContainer<T, N, G>::operator=(const SmallContainer& rhs) {
+    if (this != &rhs) {
+        if (rhs.size() <= size()) {
+            // assign over live elements, then destroy the surplus
+            std::copy(rhs.begin(), rhs.end(), begin());
+            destroy_from(begin() + rhs.size());
+        } else if (rhs.size() <= allocated) {
+            // assign over live elements, then construct the rest in place
+            std::copy(rhs.begin(), rhs.begin() + size(), begin());
+            std::uninitialized_copy(rhs.begin() + size(), rhs.end(), end());
+            used = rhs.size();
+        } else {
+            SmallContainer temp(rhs);
+
+            *this = std::move(temp);
+        }
+    }
+    return *this;
+}
+
+// Move assignment operator
+template <class T, std::size_t N, class G>
+SmallContainer<T, N, G>& SmallContainer<T, N, G>::operator=(SmallContainer&& rhs) {
+    if (this != &rhs) {
+        clear();
+        reset_storage();
+        steal(rhs);
+    }
+    return *this;
+}
+
+/// Returns other appended to this.
+/// @returns this
+template <class T, std::size_t N, class G>
+SmallContainer<T, N, G>& SmallContainer<T, N, G>::operator+=(const SmallContainer& other) {
+    const size_type count = other.size();
+
+    if (size() + count > allocated) {
+        // other may be *this; it is read through other.begin() after the move
+        reallocate(G::next_capacity(allocated, size() + count));
+    }
+    std::uninitialized_copy(other.begin(), other.begin() + count, end());
+    used = size() + count;
+
+    return *this;
+}
+
+// related non-member functions
+
+/// Equality comparison operator.
+/// @returns true if lhs compares equal to rhs, otherwise false
+template <class T, std::size_t N, class G>
+bool operator==(const SmallContainer<T, N, G>& lhs, const SmallContainer<T, N, G>& rhs) {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+/// Inequality comparison operator.
+/// @returns true if lhs does not compare equal to rhs, otherwise false
+template <class T, std::size_t N, class G>
+bool operator!=(const SmallContainer<T, N, G>& lhs, const SmallContainer<T, N, G>& rhs) {
+    return !(lhs == rhs);
+}
+
+/// Returns the concatenation of lhs and rhs.
+template <class T, std::size_t N, class G>
+SmallContainer<T, N, G> operator+(const SmallContainer<T, N, G>& lhs,
+                                  const SmallContainer<T, N, G>& rhs) {
+    SmallContainer<T, N, G> box(lhs.size() + rhs.size());
+
+    box += lhs;
+    box += rhs;
+    return box;
+}
+
+/// Writes a formatted representation of rhs to output.
+/// @returns output
+template <class T, std::size_t N, class G>
+std::ostream& operator<<(std::ostream& output, const SmallContainer<T, N, G>& oset) {
+    output << '{';
+
+    BufferedWriter writer(output);
+
+    for (auto item = oset.begin(); item != oset.end(); ++item) {
+        if (item != oset.begin()) {
+            writer.put(',');
+        }
+        writer.write(*item);
+    }
+
+    writer.put('}');
+
+    return output;
+}
+
+#endif /* SMALL_CONTAINER_HPP */
+
+/* EOF */
@@ -0,0 +1,165 @@
+/// @file SoAContainer-test.cpp
+/// @brief Catch2 Unit tests for the struct-of-arrays SoAContainer
+
+#define CATCH_CONFIG_MAIN
+#if defined __linux__
+#include <catch.hpp>
+#elif defined __MACH__
+#include </opt/local/include/catch2/catch.hpp>
+#else
+#include "catch.hpp"
+#endif
+
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <tuple>
+
+#include "SoAContainer.hpp"
+#include "SoAContainer.hpp"  // check include guard
+
+namespace {
+/// Field type whose copies throw once armed, to test partial rows.
+struct Fragile {
+    static bool armed;
+    int value = 0;
+
+    Fragile(int v) : value(v) {}
+    Fragile(const Fragile& other) : value(other.value) {
+        if (armed) {
+            throw std::runtime_error("copy failed");
+        }
+    }
+    Fragile& operator=(const Fragile&) = default;
+
+    friend bool operator==(const Fragile& lhs, const Fragile& rhs) { return lhs.value == rhs.value; }
+};
+
+bool Fragile::armed = false;
+}  // namespace
+
+TEMPLATE_TEST_CASE("SoAContainer()", "", char, int, double) {
+    const SoAContainer<TestType, int> box1{};
+
+    CHECK(box1.size() == 0);
+    CHECK(box1.empty() == true);
+    CHECK(box1.begin() == box1.end());
+    CHECK(box1.template column<0>().empty() == true);
+    CHECK_THROWS_AS(box1.at(0), std::out_of_range);
+
+    const SoAContainer<TestType, int> box2(100);
+    CHECK(box2.size() == 0);
+    CHECK(box2.capacity() == 100);
+}
+
+TEMPLATE_TEST_CASE("SoAContainer push_back() and operator[]", "", char, int, double) {
+    SoAContainer<TestType, int, double> box1{};
+
+    box1.push_back({ TestType(65), 1, 0.5 });
+    box1.emplace_back(TestType(66), 2, 1.5);
+    const std::tuple<TestType, int, double> row { TestType(67), 3, 2.5 };
+    box1.push_back(row);
+
+    REQUIRE(box1.size() == 3);
+    CHECK(std::get<0>(box1[0]) == TestType(65));
+    CHECK(std::get<1>(box1[1]) == 2);
+    CHECK(std::get<2>(box1.at(2)) == 2.5);
+    CHECK_THROWS_AS(box1.at(3), std::out_of_range);
+
+    // the references write through to the columns
+    std::get<1>(box1[1]) = 20;
+    auto [letter, number, fraction] = box1[2];
+    number = 30;
+    CHECK(box1.template column<1>()[1] == 20);
+    CHECK(box1.template column<1>()[2] == 30);
+    CHECK(letter == TestType(67));
+    CHECK(fraction == 2.5);
+}
+
+TEMPLATE_TEST_CASE("SoAContainer columns are contiguous", "", char, int, double) {
+    SoAContainer<int, TestType> box1{};
+
+    for (int i = 0; i < 1000; ++i) {
+        box1.emplace_back(i, TestType(i % 100));
+    }
+
+    const auto ids = box1.template column<0>();
+    REQUIRE(ids.size() == 1000);
+    CHECK(ids.end() - ids.begin() == 1000);
+    CHECK(std::accumulate(ids.begin(), ids.end(), 0) == 999 * 1000 / 2);
+
+    auto values = box1.template column<1>();
+    std::fill(values.begin(), values.end(), TestType(7));
+    CHECK(std::get<1>(box1[999]) == TestType(7));
+
+    CHECK(box1.template find<0>(500) == 500);
+    CHECK(box1.template find<0>(1000) == box1.size());
+    CHECK(box1.template find<1>(TestType(7)) == 0);
+}
+
+TEMPLATE_TEST_CASE("SoAContainer erase(), pop_back() and clear()", "", char, int, double) {
+    SoAContainer<TestType, int> box1{};
+
+    for (int i = 0; i < 5; ++i) {
+        box1.emplace_back(TestType(65 + i), i);
+    }
+
+    box1.erase(1);
+    CHECK(box1.size() == 4);
+    CHECK(box1[1] == std::make_tuple(TestType(67), 2));
+    CHECK_THROWS_AS(box1.erase(4), std::out_of_range);
+
+    box1.pop_back();
+    CHECK(box1.size() == 3);
+    CHECK(box1.template column<0>().size() == box1.template column<1>().size());
+
+    box1.clear();
+    CHECK(box1.empty() == true);
+    CHECK_THROWS_AS(box1.pop_back(), std::out_of_range);
+}
+
+TEMPLATE_TEST_CASE("SoAContainer copy, move and operator==", "", char, int, double) {
+    SoAContainer<TestType, int> box1{};
+    box1.emplace_back(TestType(65), 1);
+    box1.emplace_back(TestType(66), 2);
+
+    SoAContainer<TestType, int> box2 { box1 };
+    CHECK(box2 == box1);
+
+    std::get<1>(box2[0]) = 10;
+    CHECK(box2 != box1);
+
+    SoAContainer<TestType, int> box3 { std::move(box2) };
+    CHECK(std::get<1>(box3[0]) == 10);
+
+    box3.swap(box1);
+    CHECK(std::get<1>(box1[0]) == 10);
+    CHECK(std::get<1>(box3[0]) == 1);
+}
+
+TEST_CASE("SoAContainer keeps its columns aligned when a field throws") {
+    SoAContainer<int, Fragile, std::string> box1{};
+    const Fragile item { 2 };
+
+    box1.emplace_back(1, item, "Alpha");
+    Fragile::armed = true;
+    CHECK_THROWS_AS(box1.emplace_back(2, item, "Bravo"), std::runtime_error);
+    Fragile::armed = false;
+
+    CHECK(box1.size() == 1);
+    CHECK(box1.column<0>().size() == 1);
+    CHECK(box1.column<2>().size() == 1);
+}
+
+TEST_CASE("std::ostream& operator<<(std::ostream&, const SoAContainer&)") {
+    SoAContainer<int, std::string> box1{};
+    box1.emplace_back(1, "Alpha");
+    box1.emplace_back(2, "Bravo");
+
+    std::ostringstream output{};
+    output << box1;
+    CHECK(output.str() == "{(1,Alpha),(2,Bravo)}");
+}
+
+/* EOF */
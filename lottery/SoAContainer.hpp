@@ -0,0 +1,403 @@
+/// @file SoAContainer.hpp
+/// @author Brandon Timok <8000477724@student.csn.edu>
+/// @date 03/14/2022
+/// @brief A SoAContainer stores records field by field: each field has its
+/// own Container column, so a scan over one field reads only that field.
+
+#ifndef SOA_CONTAINER_HPP
+#define SOA_CONTAINER_HPP
+#include <iostream>
+#include <cstdlib>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <stdexcept>
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+
+#include "Container.hpp"
+#include "../common/BufferedWriter.hpp"
+
+/// A contiguous, non-owning view of count elements, e.g. one column of a
+/// SoAContainer.
+template <class T>
+class Span {
+public:
+    /// Member types.
+    using value_type = std::remove_cv_t<T>;
+    using size_type  = std::size_t;
+    using pointer    = T*;
+
+    Span() = default;
+    Span(pointer first, size_type count) : first(first), count(count) {}
+
+    /// A view of mutable elements converts to a view of const ones.
+    template <class U, class = std::enable_if_t<std::is_convertible<U*, T*>::value>>
+    Span(const Span<U>& other) : first(other.data()), count(other.size()) {}
+
+    bool empty() const { return count == 0; }
+    size_type size() const { return count; }
+    pointer data() const { return first; }
+
+    pointer begin() const { return first; }
+    pointer end() const { return first + count; }
+
+    T& operator[](size_type pos) const { return first[pos]; }
+
+private:
+    pointer   first = nullptr; ///< First element viewed.
+    size_type count = 0;       ///< Number of elements viewed.
+};
+
+/// A Container of records with fields Fields..., stored as one column per
+/// field (struct of arrays).
+///
+/// Rows are added and read through a row-oriented facade: push_back takes a
+/// whole record and operator[] returns a tuple of references to its fields.
+/// column<I>() gives the contiguous storage of field I for scans that need
+/// only that field. All columns always have size() elements.
+template <class... Fields>
+class SoAContainer {
+    static_assert(sizeof...(Fields) > 0, "SoAContainer needs at least one field");
+
+    template <bool Const>
+    class Iterator;
+
+public:
+    /// Member types.
+    using value_type      = std::tuple<Fields...>;
+    using reference       = std::tuple<Fields&...>;
+    using const_reference = std::tuple<const Fields&...>;
+    using size_type       = std::size_t;
+    using iterator        = Iterator<false>;
+    using const_iterator  = Iterator<true>;
+
+    /// Type of field I.
+    template <std::size_t I>
+    using field_type = std::tuple_element_t<I, value_type>;
+
+    /// Number of fields in a record.
+    static constexpr size_type field_count = sizeof...(Fields);
+
+    /// Default ctor. Reserves room for count records without adding any.
+    SoAContainer(size_type count = 0) : columns(Container<Fields>(count)...) {}
+
+    /// Checks if the container has no records.
+    bool empty() const { return size() == 0; }
+
+    /// Returns the number of records in the container.
+    size_type size() const { return std::get<0>(columns).size(); }
+
+    /// Returns the number of records that fit without reallocating a column.
+    size_type capacity() const;
+
+    /// Grows every column to hold at least new_cap records. Never shrinks.
+    void reserve(size_type new_cap);
+
+    /// Releases the unused capacity of every column.
+    void shrink_to_fit();
+
+    /// Returns an iterator to the first record.
+    iterator begin() { return { this, 0 }; }
+    const_iterator begin() const { return { this, 0 }; }
+
+    /// Returns an iterator to the end (the record following the last record).
+    iterator end() { return { this, size() }; }
+    const_iterator end() const { return { this, size() }; }
+
+    /// Adds a record to the end.
+    void push_back(const value_type& row);
+    void push_back(value_type&& row);
+
+    /// Adds a record to the end, each field constructed from the matching
+    /// argument. If a field throws, the fields already added are removed.
+    template <class... Args>
+    void emplace_back(Args&&... args);
+
+    /// Removes the last record.
+    void pop_back();
+
+    /// Removes the record at pos, shifting the later ones down.
+    /// @throws std::out_of_range if pos is not below size().
+    void erase(size_type pos);
+
+    /// Removes every record.
+    void clear();
+
+    /// Exchanges the contents of the container with those of other.
+    void swap(SoAContainer& other) { columns.swap(other.columns); }
+
+    /// Returns the contiguous storage of field I, e.g. for vectorized scans.
+    template <std::size_t I>
+    Span<field_type<I>> column() {
+        auto& box = std::get<I>(columns);
+        return { box.begin(), box.size() };
+    }
+
+    template <std::size_t I>
+    Span<const field_type<I>> column() const {
+        const auto& box = std::get<I>(columns);
+        return { box.begin(), box.size() };
+    }
+
+    /// Finds the first record whose field I equals target, scanning only
+    /// that column.
+    /// @returns the index of the record, or size() if not found.
+    template <std::size_t I>
+    size_type find(const field_type<I>& target) const;
+
+    /// Returns the fields of the record at the index chosen.
+    /// Checks for out of bounds.
+    reference at(size_type pos);
+    const_reference at(size_type pos) const;
+
+    /// Returns the fields of the record at the index chosen.
+    /// Does not check for bounds.
+    reference operator[](size_type pos) { return row(pos, indices{}); }
+    const_reference operator[](size_type pos) const { return row(pos, indices{}); }
+
+    /// Equality comparison operator, a column at a time.
+    /// @returns true if lhs compares equal to rhs, otherwise false
+    friend bool operator==(const SoAContainer& lhs, const SoAContainer& rhs) {
+        return lhs.columns == rhs.columns;
+    }
+
+private:
+    using indices = std::index_sequence_for<Fields...>;
+
+    /// Returns references to the fields of the record at pos.
+    template <std::size_t... I>
+    reference row(size_type pos, std::index_sequence<I...>) {
+        return reference(std::get<I>(columns)[pos]...);
+    }
+
+    template <std::size_t... I>
+    const_reference row(size_type pos, std::index_sequence<I...>) const {
+        return const_reference(std::get<I>(columns)[pos]...);
+    }
+
+    /// Adds one field to each column, undoing the ones done if one throws.
+    template <std::size_t... I, class... Args>
+    void emplace_row(std::index_sequence<I...>, Args&&... args);
+
+    /// Applies fn to every column.
+    template <class Function>
+    void each_column(Function fn) {
+        std::apply([&fn](auto&... box) { (fn(box), ...); }, columns);
+    }
+
+    std::tuple<Container<Fields>...> columns; ///< One column per field.
+};
+
+/// Random access iterator over the records of a SoAContainer. Dereferencing
+/// yields a tuple of references to the fields, not a record object.
+template <class... Fields>
+template <bool Const>
+class SoAContainer<Fields...>::Iterator {
+    using owner_type = std::conditional_t<Const, const SoAContainer, SoAContainer>;
+
+public:
+    // member types
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = typename SoAContainer::value_type;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference         = std::conditional_t<Const, typename SoAContainer::const_reference,
+                                                 typename SoAContainer::reference>;
+
+    Iterator() = default;
+    Iterator(owner_type* owner, size_type pos) : owner(owner), pos(pos) {}
+
+    /// A mutable iterator converts to a const one.
+    template <bool C = Const, class = std::enable_if_t<!C>>
+    operator Iterator<true>() const { return { owner, pos }; }
+
+    reference operator*() const { return (*owner)[pos]; }
+    reference operator[](difference_type n) const { return (*owner)[pos + n]; }
+
+    Iterator& operator++() { ++pos; return *this; }
+    Iterator operator++(int) { Iterator tmp = *this; ++pos; return tmp; }
+    Iterator& operator--() { --pos; return *this; }
+    Iterator operator--(int) { Iterator tmp = *this; --pos; return tmp; }
+
+    Iterator& operator+=(difference_type n) { pos += n; return *this; }
+    Iterator& operator-=(difference_type n) { pos -= n; return *this; }
+
+    friend Iterator operator+(Iterator itr, difference_type n) { return itr += n; }
+    friend Iterator operator+(difference_type n, Iterator itr) { return itr += n; }
+    friend Iterator operator-(Iterator itr, difference_type n) { return itr -= n; }
+
+    friend difference_type operator-(const Iterator& lhs, const Iterator& rhs) {
+        return static_cast<difference_type>(lhs.pos) - static_cast<difference_type>(rhs.pos);
+    }
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) { return lhs.pos == rhs.pos; }
+    friend bool operator!=(const Iterator& lhs, const Iterator& rhs) { return lhs.pos != rhs.pos; }
+    friend bool operator<(const Iterator& lhs, const Iterator& rhs) { return lhs.pos < rhs.pos; }
+    friend bool operator>(const Iterator& lhs, const Iterator& rhs) { return lhs.pos > rhs.pos; }
+    friend bool operator<=(const Iterator& lhs, const Iterator& rhs) { return lhs.pos <= rhs.pos; }
+    friend bool operator>=(const Iterator& lhs, const Iterator& rhs) { return lhs.pos >= rhs.pos; }
+
+private:
+    owner_type* owner = nullptr; ///< Container iterated over.
+    size_type   pos = 0;         ///< Index of the record referred to.
+};
+
+// related non-member functions
+
+/// Inequality comparison operator.
+/// @returns true if lhs does not compare equal to rhs, otherwise false
+template <class... Fields>
+bool operator!=(const SoAContainer<Fields...>& lhs, const SoAContainer<Fields...>& rhs);
+
+/// Writes a formatted representation of rhs to output, one (...) per record.
+/// @returns output
+template <class... Fields>
+std::ostream& operator<<(std::ostream& output, const SoAContainer<Fields...>& oset);
+
+// ============================================================================
+
+/// Returns the number of records that fit without reallocating a column.
+template <class... Fields>
+typename SoAContainer<Fields...>::size_type SoAContainer<Fields...>::capacity() const {
+    return std::apply([](const auto&... box) { return std::min({ box.capacity()... }); }, columns);
+}
+
+/// Grows every column to hold at least new_cap records. Never shrinks.
+template <class... Fields>
+void SoAContainer<Fields...>::reserve(size_type new_cap) {
+    each_column([new_cap](auto& box) { box.reserve(new_cap); });
+}
+
+/// Releases the unused capacity of every column.
+template <class... Fields>
+void SoAContainer<Fields...>::shrink_to_fit() {
+    each_column([](auto& box) { box.shrink_to_fit(); });
+}
+
+/// Adds one field to each column, undoing the ones done if one throws.
+template <class... Fields>
+template <std::size_t... I, class... Args>
+void SoAContainer<Fields...>::emplace_row(std::index_sequence<I...>, Args&&... args) {
+    size_type done = 0;
+
+    try {
+        ((std::get<I>(columns).emplace_back(std::forward<Args>(args)), ++done), ...);
+    } catch (...) {
+        // keep every column at the same size
+        ((I < done ? std::get<I>(columns).pop_back() : void()), ...);
+        throw;
+    }
+}
+
+/// Adds a record to the end.
+template <class... Fields>
+void SoAContainer<Fields...>::push_back(const value_type& row) {
+    std::apply([this](const auto&... field) { emplace_row(indices{}, field...); }, row);
+}
+
+///
+template <class... Fields>
+void SoAContainer<Fields...>::push_back(value_type&& row) {
+    std::apply([this](auto&... field) { emplace_row(indices{}, std::move(field)...); }, row);
+}
+
+/// Adds a record to the end, each field constructed from the matching argument.
+template <class... Fields>
+template <class... Args>
+void SoAContainer<Fields...>::emplace_back(Args&&... args) {
+    static_assert(sizeof...(Args) == sizeof...(Fields), "emplace_back takes one argument per field");
+    emplace_row(indices{}, std::forward<Args>(args)...);
+}
+
+/// Removes the last record.
+template <class... Fields>
+void SoAContainer<Fields...>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("pop_back on empty SoAContainer");
+    }
+    each_column([](auto& box) { box.pop_back(); });
+}
+
+/// Removes the record at pos, shifting the later ones down.
+template <class... Fields>
+void SoAContainer<Fields...>::erase(size_type pos) {
+    if (pos >= size()) {
+        throw std::out_of_range("Out of bounds");
+    }
+    each_column([pos](auto& box) { box.erase(box.begin() + pos); });
+}
+
+/// Removes every record.
+template <class... Fields>
+void SoAContainer<Fields...>::clear() {
+    each_column([](auto& box) { box.clear(); });
+}
+
+/// Finds the first record whose field I equals target, scanning only that column.
+/// @returns the index of the record, or size() if not found.
+template <class... Fields>
+template <std::size_t I>
+typename SoAContainer<Fields...>::size_type
+SoAContainer<Fields...>::find(const field_type<I>& target) const {
+    const auto& box = std::get<I>(columns);
+    return box.find(target) - box.begin();
+}
+
+///
+template <class... Fields>
+typename SoAContainer<Fields...>::reference SoAContainer<Fields...>::at(size_type pos) {
+    if (pos >= size()) {
+        throw std::out_of_range("Out of bounds");
+    }
+    return (*this)[pos];
+}
+
+///
+template <class... Fields>
+typename SoAContainer<Fields...>::const_reference SoAContainer<Fields...>::at(size_type pos) const {
+    if (pos >= size()) {
+        throw std::out_of_range("Out of bounds");
+    }
+    return (*this)[pos];
+}
+
+// related non-member functions
+
+/// Inequality comparison operator.
+/// @returns true if lhs does not compare equal to rhs, otherwise false
+template <class... Fields>
+bool operator!=(const SoAContainer<Fields...>& lhs, const SoAContainer<Fields...>& rhs) {
+    return !(lhs == rhs);
+}
+
+/// Writes a formatted representation of rhs to output, one (...) per record.
+/// @returns output
+template <class... Fields>
+std::ostream& operator<<(std::ostream& output, const SoAContainer<Fields...>& oset) {
+    output << '{';
+
+    BufferedWriter writer(output);
+
+    for (auto item = oset.begin(); item != oset.end(); ++item) {
+        if (item != oset.begin()) {
+            writer.put(',');
+        }
+        writer.put('(');
+        std::apply([&writer](const auto& first, const auto&... rest) {
+            writer.write(first);
+            ((writer.put(','), writer.write(rest)), ...);
+        }, *item);
+        writer.put(')');
+    }
+
+    writer.put('}');
+
+    return output;
+}
+
+#endif /* SOA_CONTAINER_HPP */
+
+/* EOF */
@@ -0,0 +1,145 @@
+/// @file StaticContainer-test.cpp
+/// @brief Catch2 Unit tests for the fixed-capacity StaticContainer
+
+#define CATCH_CONFIG_MAIN
+#if defined __linux__
+#include <catch.hpp>
+#elif defined __MACH__
+#include </opt/local/include/catch2/catch.hpp>
+#else
+#include "catch.hpp"
+#endif
+
+#include <algorithm>
+#include <initializer_list>
+#include <sstream>
+#include <string>
+
+#include "StaticContainer.hpp"
+#include "StaticContainer.hpp"  // check include guard
+
+namespace {
+/// A table of squares, built by the compiler.
+constexpr StaticContainer<int, 10> squares() {
+    StaticContainer<int, 10> table{};
+
+    for (int i = 0; i < 10; ++i) {
+        table.push_back(i * i);
+    }
+    return table;
+}
+
+constexpr StaticContainer<int, 10> SQUARES = squares();
+
+static_assert(SQUARES.size() == 10, "table built at compile time");
+static_assert(SQUARES[7] == 49, "table built at compile time");
+static_assert(SQUARES.at(9) == 81, "table built at compile time");
+static_assert(SQUARES.find(64) == SQUARES.begin() + 8, "find() is constexpr");
+static_assert(SQUARES.find(2) == SQUARES.end(), "find() is constexpr");
+
+constexpr StaticContainer<int, 8> edited() {
+    StaticContainer<int, 8> table { 1, 2, 3, 4, 5 };
+
+    table.erase(table.begin() + 1);
+    table.erase(table.begin(), table.begin() + 2);
+    table += StaticContainer<int, 2>{ 6, 7 };
+    table.pop_back();
+    return table;
+}
+
+static_assert(edited() == StaticContainer<int, 3>{ 4, 5, 6 }, "mutators are constexpr");
+}  // namespace
+
+TEMPLATE_TEST_CASE("StaticContainer()", "", char, int, double) {
+    const StaticContainer<TestType, 5> box1{};
+
+    CHECK(box1.size() == 0);
+    CHECK(box1.empty() == true);
+    CHECK(box1.capacity() == 5);
+    CHECK(box1.begin() == box1.end());
+    CHECK_THROWS_AS(box1.at(0), std::out_of_range);
+}
+
+TEMPLATE_TEST_CASE("StaticContainer(initializer_list)", "", char, int, double) {
+    const StaticContainer<TestType, 8> box1 { 65, 66, 67, 68, 69 };
+    const TestType EXPECTED[] = { 65, 66, 67, 68, 69 };
+
+    REQUIRE(box1.size() == 5);
+    CHECK(std::equal(box1.begin(), box1.end(), std::begin(EXPECTED), std::end(EXPECTED)));
+    CHECK_THROWS_AS((StaticContainer<TestType, 2>{ 65, 66, 67 }), std::length_error);
+}
+
+TEMPLATE_TEST_CASE("StaticContainer push_back() checks the capacity", "", char, int, double) {
+    StaticContainer<TestType, 3> box1{};
+
+    box1.push_back(TestType(65));
+    box1.push_back(TestType(66));
+    box1.emplace_back(TestType(67));
+
+    CHECK(box1 == StaticContainer<TestType, 3>{ 65, 66, 67 });
+    CHECK_THROWS_AS(box1.push_back(TestType(68)), std::length_error);
+    CHECK(box1.size() == 3);
+
+    box1.pop_back();
+    CHECK(box1 == StaticContainer<TestType, 3>{ 65, 66 });
+    box1.clear();
+    CHECK(box1.empty() == true);
+    CHECK_THROWS_AS(box1.pop_back(), std::out_of_range);
+}
+
+TEMPLATE_TEST_CASE("StaticContainer erase()", "", char, int, double) {
+    StaticContainer<TestType, 8> box1 { 65, 66, 67, 68, 69, 70 };
+
+    box1.erase(box1.begin() + 2);
+    CHECK(box1 == StaticContainer<TestType, 8>{ 65, 66, 68, 69, 70 });
+
+    CHECK(box1.erase(box1.begin() + 1, box1.begin() + 3) == box1.begin() + 1);
+    CHECK(box1 == StaticContainer<TestType, 8>{ 65, 69, 70 });
+
+    box1.erase(nullptr);
+    CHECK(box1.size() == 3);
+    CHECK_THROWS_AS(box1.erase(box1.end()), std::out_of_range);
+    CHECK_THROWS_AS(box1.erase(box1.begin() + 2, box1.begin() + 1), std::out_of_range);
+}
+
+TEMPLATE_TEST_CASE("StaticContainer find() and at()", "", char, int, double) {
+    StaticContainer<TestType, 8> box1 { 42, 65, 66, 42, 67 };
+
+    CHECK(box1.find(TestType(42)) == box1.begin());
+    CHECK(box1.find(TestType(42), box1.begin() + 1) == box1.begin() + 3);
+    CHECK(box1.find(TestType(73)) == box1.end());
+
+    box1.at(1) = TestType(70);
+    CHECK(box1[1] == TestType(70));
+    CHECK_THROWS_AS(box1.at(5), std::out_of_range);
+}
+
+TEMPLATE_TEST_CASE("StaticContainer operator+=", "", char, int, double) {
+    StaticContainer<TestType, 6> box1 { 65, 66 };
+    const StaticContainer<TestType, 3> box2 { 67, 68, 69 };
+
+    box1 += box2;
+    CHECK(box1 == StaticContainer<TestType, 5>{ 65, 66, 67, 68, 69 });
+
+    // too long: nothing is appended
+    CHECK_THROWS_AS(box1 += box2, std::length_error);
+    CHECK(box1.size() == 5);
+
+    StaticContainer<TestType, 4> box3 { 65, 66 };
+    box3 += box3;
+    CHECK(box3 == StaticContainer<TestType, 4>{ 65, 66, 65, 66 });
+}
+
+TEST_CASE("StaticContainer<std::string>") {
+    StaticContainer<std::string, 4> box1 { "Alpha", "Bravo", "Charlie" };
+
+    box1.erase(box1.begin());
+    box1.emplace_back(3, 'D');
+    CHECK(box1 == StaticContainer<std::string, 4>{ "Bravo", "Charlie", "DDD" });
+
+    std::ostringstream output{};
+    output << box1 << SQUARES;
+    CHECK(output.str() == "{Bravo,Charlie,DDD}{0,1,4,9,16,25,36,49,64,81}");
+}
+
+/* EOF */
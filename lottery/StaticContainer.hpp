@@ -0,0 +1,308 @@
+/// @file StaticContainer.hpp
+/// @author Brandon Timok <8000477724@student.csn.edu>
+/// @date 03/14/2022
+/// @brief A StaticContainer holds at most N elements inside the object and
+/// never touches the heap. Every member is constexpr, so tables can be built
+/// at compile time.
+
+#ifndef STATIC_CONTAINER_HPP
+#define STATIC_CONTAINER_HPP
+#include <initializer_list>
+#include <iostream>
+#include <cstdlib>
+#include <cstddef>
+#include <utility>
+#include <stdexcept>
+
+#include "../common/BufferedWriter.hpp"
+
+/// A Container with a fixed capacity of N, stored inline.
+///
+/// All N slots hold a T at all times (C++17 cannot start an object's
+/// lifetime in a constant expression), so T must be default constructible
+/// and assignable. Slots past size() hold value-initialized T. For trivially
+/// destructible T the whole container is a literal type and usable in
+/// constexpr contexts. Adding past N throws std::length_error, which in a
+/// constant expression is a compile error.
+template <class T, std::size_t N>
+class StaticContainer {
+public:
+    /// Member types.
+    using value_type    = T;
+    using size_type     = std::size_t;
+    using pointer       = value_type*;
+    using const_pointer = const value_type*;
+
+    /// Default ctor.
+    constexpr StaticContainer() = default;
+
+    /// Initializer List ctor
+    /// @throws std::length_error if init holds more than N items.
+    constexpr StaticContainer(const std::initializer_list<value_type>& init);
+
+    /// Checks if the container has no elements, e.g begin() == end()
+    /// @returns true if the container is empty, false otherwise.
+    constexpr bool empty() const { return used == 0; }
+
+    /// Returns the number of elements in the container.
+    constexpr size_type size() const { return used; }
+
+    /// Returns the number of elements the container can hold: N.
+    static constexpr size_type capacity() { return N; }
+
+    /// Returns a pointer to the first element.
+    constexpr pointer begin() { return items; }
+    constexpr const_pointer begin() const { return items; }
+
+    /// Returns a pointer to the end (the element following the last element).
+    constexpr pointer end() { return items + used; }
+    constexpr const_pointer end() const { return items + used; }
+
+    /// Adds an element to the end.
+    /// @throws std::length_error if the container is full.
+    constexpr void push_back(const value_type& value) { emplace_back(value); }
+    constexpr void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+    /// Constructs an element at the end from args.
+    /// @returns a reference to the new element.
+    /// @throws std::length_error if the container is full.
+    template <class... Args>
+    constexpr T& emplace_back(Args&&... args);
+
+    /// Removes the last element.
+    constexpr void pop_back();
+
+    /// Removes a single item from the container.
+    constexpr void erase(pointer pos);
+
+    /// Removes the items in [first, last), shifting the tail down once.
+    /// @returns pointer to the element that followed the removed range.
+    constexpr pointer erase(pointer first, pointer last);
+
+    /// Removes every element.
+    constexpr void clear();
+
+    /// Finds the first element equal to the given target. Search begins at pos.
+    /// @returns pointer to the element if found, or end() if not found.
+    constexpr pointer find(const value_type& target, pointer pos = nullptr);
+    constexpr const_pointer find(const value_type& target, const_pointer pos = nullptr) const;
+
+    /// Appends other to this.
+    /// @returns this
+    /// @throws std::length_error if the result would not fit; this is unchanged.
+    template <std::size_t M>
+    constexpr StaticContainer& operator+=(const StaticContainer<T, M>& other);
+
+    /// Returns the value at the index chosen.
+    /// Checks for out of bounds.
+    constexpr T& at(size_type pos);
+    constexpr const T& at(size_type pos) const;
+
+    /// Returns the value at the index chosen.
+    /// Does not check for bounds.
+    constexpr T& operator[](size_type pos) { return items[pos]; }
+    constexpr const T& operator[](size_type pos) const { return items[pos]; }
+
+private:
+    value_type items[N > 0 ? N : 1]{}; ///< Elements in [0, used), then spare slots.
+    size_type  used = 0;               ///< Number of items in container.
+};
+
+// related non-member functions
+
+/// Equality comparison operator.
+/// @returns true if lhs compares equal to rhs, otherwise false
+template <class T, std::size_t N, std::size_t M>
+constexpr bool operator==(const StaticContainer<T, N>& lhs, const StaticContainer<T, M>& rhs);
+
+/// Inequality comparison operator.
+/// @returns true if lhs does not compare equal to rhs, otherwise false
+template <class T, std::size_t N, std::size_t M>
+constexpr bool operator!=(const StaticContainer<T, N>& lhs, const StaticContainer<T, M>& rhs);
+
+/// Writes a formatted representation of rhs to output.
+/// @returns output
+template <class T, std::size_t N>
+std::ostream& operator<<(std::ostream& output, const StaticContainer<T, N>& oset);
+
+// ============================================================================
+
+/// Initializer List ctor
+template <class T, std::size_t N>
+constexpr StaticContainer<T, N>::StaticContainer(const std::initializer_list<value_type>& init) {
+    if (init.size() > N) {
+        throw std::length_error("StaticContainer is full");
+    }
+    for (const auto& item : init) {
+        items[used++] = item;
+    }
+}
+
+/// Constructs an element at the end from args.
+/// @returns a reference to the new element.
+template <class T, std::size_t N>
+template <class... Args>
+constexpr T& StaticContainer<T, N>::emplace_back(Args&&... args) {
+    if (used == N) {
+        throw std::length_error("StaticContainer is full");
+    }
+    items[used] = value_type(std::forward<Args>(args)...);
+    return items[used++];
+}
+
+/// Removes the last element.
+template <class T, std::size_t N>
+constexpr void StaticContainer<T, N>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("pop_back on empty StaticContainer");
+    }
+    items[--used] = value_type();
+}
+
+/// Removes a single item from the container.
+template <class T, std::size_t N>
+constexpr void StaticContainer<T, N>::erase(pointer pos) {
+    if (pos != nullptr) {
+        if (pos < begin() || pos >= end()) {
+            throw std::out_of_range("Out of bounds");
+        }
+        erase(pos, pos + 1);
+    }
+}
+
+/// Removes the items in [first, last), shifting the tail down once.
+/// @returns pointer to the element that followed the removed range.
+template <class T, std::size_t N>
+constexpr typename StaticContainer<T, N>::pointer
+StaticContainer<T, N>::erase(pointer first, pointer last) {
+    if (first < begin() || last > end() || first > last) {
+        throw std::out_of_range("Out of bounds");
+    }
+
+    // std::move is not constexpr until C++20
+    pointer dest = first;
+
+    for (pointer source = last; source != end(); ++source, ++dest) {
+        *dest = std::move(*source);
+    }
+    for (pointer spare = dest; spare != end(); ++spare) {
+        *spare = value_type();
+    }
+    used = dest - begin();
+    return first;
+}
+
+/// Removes every element.
+template <class T, std::size_t N>
+constexpr void StaticContainer<T, N>::clear() {
+    erase(begin(), end());
+}
+
+/// Finds the first element equal to the given target. Search begins at pos.
+/// @returns pointer to the element if found, or end() if not found.
+template <class T, std::size_t N>
+constexpr typename StaticContainer<T, N>::pointer
+StaticContainer<T, N>::find(const value_type& target, pointer pos) {
+    pointer item = pos == nullptr ? begin() : pos;
+
+    while (item != end() && !(*item == target)) {
+        ++item;
+    }
+    return item;
+}
+
+///
+template <class T, std::size_t N>
+constexpr typename StaticContainer<T, N>::const_pointer
+StaticContainer<T, N>::find(const value_type& target, const_pointer pos) const {
+    const_pointer item = pos == nullptr ? begin() : pos;
+
+    while (item != end() && !(*item == target)) {
+        ++item;
+    }
+    return item;
+}
+
+/// Appends other to this.
+/// @returns this
+template <class T, std::size_t N>
+template <std::size_t M>
+constexpr StaticContainer<T, N>& StaticContainer<T, N>::operator+=(const StaticContainer<T, M>& other) {
+    const size_type count = other.size();
+
+    if (count > N - used) {
+        throw std::length_error("StaticContainer is full");
+    }
+    // other may be *this: copy by index, up to the size it had on entry
+    for (size_type pos = 0; pos < count; ++pos) {
+        items[used + pos] = other[pos];
+    }
+    used += count;
+    return *this;
+}
+
+///
+template <class T, std::size_t N>
+constexpr T& StaticContainer<T, N>::at(size_type pos) {
+    if (pos >= used) {
+        throw std::out_of_range("Out of bounds");
+    }
+    return items[pos];
+}
+
+///
+template <class T, std::size_t N>
+constexpr const T& StaticContainer<T, N>::at(size_type pos) const {
+    if (pos >= used) {
+        throw std::out_of_range("Out of bounds");
+    }
+    return items[pos];
+}
+
+// related non-member functions
+
+/// Equality comparison operator.
+/// @returns true if lhs compares equal to rhs, otherwise false
+template <class T, std::size_t N, std::size_t M>
+constexpr bool operator==(const StaticContainer<T, N>& lhs, const StaticContainer<T, M>& rhs) {
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    for (std::size_t pos = 0; pos < lhs.size(); ++pos) {
+        if (!(lhs[pos] == rhs[pos])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Inequality comparison operator.
+/// @returns true if lhs does not compare equal to rhs, otherwise false
+template <class T, std::size_t N, std::size_t M>
+constexpr bool operator!=(const StaticContainer<T, N>& lhs, const StaticContainer<T, M>& rhs) {
+    return !(lhs == rhs);
+}
+
+/// Writes a formatted representation of rhs to output.
+/// @returns output
+template <class T, std::size_t N>
+std::ostream& operator<<(std::ostream& output, const StaticContainer<T, N>& oset) {
+    output << '{';
+
+    BufferedWriter writer(output);
+
+    for (auto item = oset.begin(); item != oset.end(); ++item) {
+        if (item != oset.begin()) {
+            writer.put(',');
+        }
+        writer.write(*item);
+    }
+
+    writer.put('}');
+
+    return output;
+}
+
+#endif /* STATIC_CONTAINER_HPP */
+
+/* EOF */
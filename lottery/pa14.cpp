@@ -7,12 +7,25 @@
 #include <iostream>
 #include <cstdlib>
 #include <ctime>
+#include <algorithm>
+#include <string>
 
-#include "Container.hpp"
+#include "StaticContainer.hpp"
+
+/// Prize for each number of matching digits, built at compile time.
+constexpr StaticContainer<int, 6> PRIZES = [] {
+    StaticContainer<int, 6> prizes;
+
+    for (int matched = 0; matched < 5; ++matched) {
+        prizes.push_back(matched * 125);
+    }
+    prizes.push_back(3000);
+    return prizes;
+}();
 
 int main() {
-    Container<int> lottery;
-    Container<int> user {0, 0, 0, 0, 0};
+    StaticContainer<int, 5> lottery;
+    StaticContainer<int, 5> user {0, 0, 0, 0, 0};
 
     int matching_num = 0;
     int prize_money = 0;
@@ -25,7 +38,7 @@ int main() {
     while (lottery.size() < 5) {
         int random_num = std::rand() % 10;
         
-        if (std::find(lottery.begin(), lottery.end(), random_num) == lottery.end()) {
+        if (lottery.find(random_num) == lottery.end()) {
             lottery.push_back(random_num);
         }
     }
@@ -37,17 +50,15 @@ int main() {
     }
 
     for (auto i = 0; i < 5; ++i) {
-        if (std::find(lottery.begin(), lottery.end(), user.at(i)) != lottery.end()) {
+        if (lottery.find(user.at(i)) != lottery.end()) {
             matching_num += 1;
         }
     }
 
     if (std::equal(user.begin(), user.end(), lottery.begin())) {
         prize_money = 10000;
-    } else if (matching_num == 5) {
-        prize_money = 3000;
     } else {
-        prize_money = matching_num * 125;
+        prize_money = PRIZES.at(matching_num);
     }
 
     std::cout << '\n';